@@ -1,58 +1,1042 @@
 #pragma once
 
 #include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
 #include <functional>
 #include <iterator>
+#include <limits>
 #include <memory>
-#include <numeric>
+#include <new>
 #include <optional>
-#include <set>
+#include <queue>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
 #include <unordered_map>
 #include <unordered_set>
 #include <vector>
 
+#include "thread_pool.hpp"
+
 namespace fpt {
 
+	/**
+	 * \brief A const tree may be queried by any number of threads at once since every query keeps its state local.
+	 *        Thread pools passed to a tree must not run other tasks until the call returns.
+	 */
 	template <typename T> class FrequentPatternTree final {
 
 		struct FrequentPatternTreeNode final {
 
 			explicit FrequentPatternTreeNode(
-				std::optional<const T> item = std::nullopt,
-				std::shared_ptr<FrequentPatternTreeNode> parent = nullptr)
-				: id{++instance_count_},
-				  item{std::move(item)},
-				  parent{std::move(parent)} {}
+				const uint32_t id,
+				const uint32_t item = 0,
+				FrequentPatternTreeNode* const parent = nullptr)
+				: id{id},
+				  item{item},
+				  parent{parent} {}
 
 			uint32_t id;
-			std::optional<T> item;
-			std::shared_ptr<FrequentPatternTreeNode> parent;
-			std::unordered_map<T, std::shared_ptr<FrequentPatternTreeNode>> children;
-			uint32_t support = 1;
+			uint32_t item;
+			FrequentPatternTreeNode* parent;
+			FrequentPatternTreeNode* first_child = nullptr;
+			FrequentPatternTreeNode* next_sibling = nullptr;
+			FrequentPatternTreeNode* previous_sibling = nullptr;
+			FrequentPatternTreeNode* next_item_node = nullptr;
+			FrequentPatternTreeNode* previous_item_node = nullptr;
+			uint32_t support = 0;
+			uint32_t child_count = 0;
+		};
+
+		struct HeaderTableEntry final {
+			uint32_t support = 0;
+			FrequentPatternTreeNode* item_nodes = nullptr;
+		};
+
+		using HeaderTable = std::vector<HeaderTableEntry>;
+
+		/**
+		 * \brief Nodes never move, so links between them are raw pointers. Released nodes reuse their ids, so ids stay
+		 *        below \c size, which counts every id ever issued.
+		 */
+		class NodeArena final {
+
+		public:
+			NodeArena() = default;
+			NodeArena(const NodeArena&) = delete;
+			NodeArena& operator=(const NodeArena&) = delete;
+
+			NodeArena(NodeArena&& node_arena) noexcept
+				: chunks_{std::exchange(node_arena.chunks_, {})},
+				  released_nodes_{std::exchange(node_arena.released_nodes_, {})},
+				  child_index_{std::exchange(node_arena.child_index_, {})},
+				  chunk_size_{std::exchange(node_arena.chunk_size_, 0)},
+				  size_{std::exchange(node_arena.size_, 0)} {}
+
+			NodeArena& operator=(NodeArena&& node_arena) noexcept {
+				chunks_ = std::exchange(node_arena.chunks_, {});
+				released_nodes_ = std::exchange(node_arena.released_nodes_, {});
+				child_index_ = std::exchange(node_arena.child_index_, {});
+				chunk_size_ = std::exchange(node_arena.chunk_size_, 0);
+				size_ = std::exchange(node_arena.size_, 0);
+				return *this;
+			}
+
+			FrequentPatternTreeNode* Create(const uint32_t item = 0, FrequentPatternTreeNode* const parent = nullptr) {
+
+				if (!released_nodes_.empty()) {
+					const auto node = released_nodes_.back();
+					released_nodes_.pop_back();
+					return new (node) FrequentPatternTreeNode{node->id, item, parent};
+				}
+
+				if (chunks_.empty() || chunk_size_ == GetChunkCapacity(chunks_.size() - 1)) {
+					chunks_.push_back(std::make_unique<NodeStorage[]>(GetChunkCapacity(chunks_.size())));
+					chunk_size_ = 0;
+				}
+
+				return new (&chunks_.back()[chunk_size_++]) FrequentPatternTreeNode{size_++, item, parent};
+			}
+
+			void Release(FrequentPatternTreeNode* const node) { released_nodes_.push_back(node); }
+
+			FrequentPatternTreeNode* FindChild(const FrequentPatternTreeNode& node, const uint32_t item) const {
+
+				if (node.child_count >= kMinimumIndexedChildCount) {
+					const auto child = child_index_.find(GetChildKey(node.id, item));
+					return child != child_index_.cend() ? child->second : nullptr;
+				}
+
+				for (auto child = node.first_child; child; child = child->next_sibling) {
+					if (child->item == item) return child;
+				}
+
+				return nullptr;
+			}
+
+			void AddChild(FrequentPatternTreeNode& node, FrequentPatternTreeNode& child) {
+
+				child.next_sibling = node.first_child;
+				if (node.first_child) node.first_child->previous_sibling = &child;
+				node.first_child = &child;
+
+				if (++node.child_count == kMinimumIndexedChildCount) {
+					for (auto sibling = node.first_child; sibling; sibling = sibling->next_sibling) {
+						child_index_.emplace(GetChildKey(node.id, sibling->item), sibling);
+					}
+				} else if (node.child_count > kMinimumIndexedChildCount) {
+					child_index_.emplace(GetChildKey(node.id, child.item), &child);
+				}
+			}
+
+			void RemoveChild(FrequentPatternTreeNode& node, const FrequentPatternTreeNode& child) {
+
+				(child.previous_sibling ? child.previous_sibling->next_sibling : node.first_child) = child.next_sibling;
+				if (child.next_sibling) child.next_sibling->previous_sibling = child.previous_sibling;
+
+				if (node.child_count-- == kMinimumIndexedChildCount) {
+					child_index_.erase(GetChildKey(node.id, child.item));
+					for (auto sibling = node.first_child; sibling; sibling = sibling->next_sibling) {
+						child_index_.erase(GetChildKey(node.id, sibling->item));
+					}
+				} else if (node.child_count >= kMinimumIndexedChildCount) {
+					child_index_.erase(GetChildKey(node.id, child.item));
+				}
+			}
+
+			[[nodiscard]] uint32_t size() const noexcept { return size_; }
 
 		private:
-			static inline uint32_t instance_count_ = 0;
+			static_assert(std::is_trivially_destructible_v<FrequentPatternTreeNode>);
+
+			static constexpr uint32_t kMinimumIndexedChildCount = 8;
+
+			static constexpr uint64_t GetChildKey(const uint32_t id, const uint32_t item) noexcept {
+				return uint64_t{id} << 32 | item;
+			}
+
+			struct alignas(FrequentPatternTreeNode) NodeStorage final {
+				std::byte bytes[sizeof(FrequentPatternTreeNode)];
+			};
+
+			static constexpr std::size_t GetChunkCapacity(const std::size_t chunk_index) noexcept {
+				return std::size_t{64} << std::min(chunk_index, std::size_t{10});
+			}
+
+			std::vector<std::unique_ptr<NodeStorage[]>> chunks_;
+			std::vector<FrequentPatternTreeNode*> released_nodes_;
+			std::unordered_map<uint64_t, FrequentPatternTreeNode*> child_index_;
+			std::size_t chunk_size_ = 0;
+			uint32_t size_ = 0;
+		};
+
+		/** \brief Conditional trees number their items densely and map each back to its rank through \c ranks. */
+		struct ConditionalTree final {
+			NodeArena arena;
+			FrequentPatternTreeNode* root = arena.Create();
+			HeaderTable header_table;
+			std::vector<uint32_t> ranks;
+		};
+
+		struct RankConstraints final {
+			std::size_t min_length = 1;
+			std::size_t max_length = std::numeric_limits<std::size_t>::max();
+			std::vector<uint32_t> required_items;
+			std::vector<bool> forbidden_items;
+			std::function<bool(const std::vector<uint32_t>&, uint32_t)> predicate;
+		};
+
+		/** \brief A null \c tree refers to the frequent pattern tree itself. */
+		struct Subproblem final {
+			std::vector<uint32_t> itemset;
+			std::shared_ptr<const ConditionalTree> tree;
+			uint32_t item;
+		};
+
+		/**
+		 * \brief The recursion over conditional trees is unrolled onto explicit frames so mining can be suspended after
+		 *        each itemset. Path frames always sit above the tree frame owning their path.
+		 */
+		class FrequentItemsetMiner final {
+
+		public:
+			FrequentItemsetMiner(
+				const FrequentPatternTreeNode& root,
+				const HeaderTable& header_table,
+				const uint32_t node_count,
+				const uint32_t minimum_support,
+				RankConstraints constraints)
+				: root_{&root},
+				  header_table_{&header_table},
+				  minimum_support_{minimum_support},
+				  constraints_{std::move(constraints)},
+				  owned_conditional_nodes_by_id_(node_count) {
+				PushTreeFrame(nullptr);
+			}
+
+			/** \brief \p conditional_nodes_by_id must be all null and may be shared by miners on the same thread. */
+			FrequentItemsetMiner(
+				Subproblem&& subproblem,
+				const FrequentPatternTreeNode& root,
+				const HeaderTable& header_table,
+				const uint32_t minimum_support,
+				RankConstraints constraints,
+				std::vector<FrequentPatternTreeNode*>& conditional_nodes_by_id)
+				: root_{&root},
+				  header_table_{&header_table},
+				  minimum_support_{minimum_support},
+				  constraints_{std::move(constraints)},
+				  conditional_nodes_by_id_{&conditional_nodes_by_id},
+				  itemset_{std::move(subproblem.itemset)} {
+
+				const auto& subproblem_header_table = subproblem.tree ? subproblem.tree->header_table : header_table;
+				const auto subproblem_ranks = subproblem.tree ? &subproblem.tree->ranks : nullptr;
+				auto conditional_tree = std::make_shared<ConditionalTree>(GetConditionalTree(subproblem.item,
+					subproblem_header_table, subproblem_ranks, minimum_support, conditional_nodes_by_id, nullptr,
+					&constraints_.forbidden_items));
+				if (conditional_tree->root->first_child) PushTreeFrame(std::move(conditional_tree));
+			}
+
+			/** \brief A handler which returns \c true takes over the subproblem and this miner skips it. */
+			void SetSubproblemHandler(std::function<bool(Subproblem&&)> subproblem_handler) {
+				subproblem_handler_ = std::move(subproblem_handler);
+			}
+
+			bool Next() {
+
+				while (!tree_frames_.empty()) {
+					if ((!path_frames_.empty() ? NextPathCombination() : NextTreeItemset())
+						&& itemset_.size() >= constraints_.min_length
+						&& itemset_.size() <= constraints_.max_length
+						&& HasRequiredItems()) {
+						return true;
+					}
+				}
+
+				return false;
+			}
+
+			[[nodiscard]] const std::vector<uint32_t>& GetItemset() const noexcept { return itemset_; }
+			[[nodiscard]] uint32_t GetSupport() const noexcept { return support_; }
+
+		private:
+			struct TreeFrame final {
+				std::shared_ptr<const ConditionalTree> conditional_tree;
+				std::vector<const FrequentPatternTreeNode*> prefix_path;
+				std::size_t itemset_size = 0;
+				uint32_t next_item = 0;
+				uint32_t first_branch_item = 0;
+				std::optional<uint32_t> pending_item;
+				bool is_prefix_path_expanded = false;
+			};
+
+			struct PathFrame final {
+				std::size_t itemset_size;
+				std::size_t path_end;
+				std::size_t next_node = 0;
+				uint32_t support;
+			};
+
+			const FrequentPatternTreeNode& GetRoot(const TreeFrame& frame) const {
+				return frame.conditional_tree ? *frame.conditional_tree->root : *root_;
+			}
+
+			const HeaderTable& GetHeaderTable(const TreeFrame& frame) const {
+				return frame.conditional_tree ? frame.conditional_tree->header_table : *header_table_;
+			}
+
+			const std::vector<uint32_t>* GetRanks(const TreeFrame& frame) const {
+				return frame.conditional_tree ? &frame.conditional_tree->ranks : nullptr;
+			}
+
+			std::vector<FrequentPatternTreeNode*>& GetConditionalNodesById() {
+				return conditional_nodes_by_id_ ? *conditional_nodes_by_id_ : owned_conditional_nodes_by_id_;
+			}
+
+			void PushTreeFrame(std::shared_ptr<const ConditionalTree> conditional_tree) {
+
+				auto& frame = tree_frames_.emplace_back();
+				frame.conditional_tree = std::move(conditional_tree);
+				frame.prefix_path = GetSinglePrefixPath(GetRoot(frame));
+				frame.itemset_size = itemset_.size();
+				frame.next_item = static_cast<uint32_t>(GetHeaderTable(frame).size());
+
+				// items ranked ahead of the end of the single prefix path can only occur on that path
+				frame.first_branch_item = frame.prefix_path.empty() ? 0 : frame.prefix_path.back()->item + 1;
+			}
+
+			bool NextTreeItemset() {
+
+				auto& frame = tree_frames_.back();
+				const auto& header_table = GetHeaderTable(frame);
+
+				// the conditional tree of the last itemset is only built once the caller asks for more itemsets
+				if (frame.pending_item) {
+					const auto pending_item = *frame.pending_item;
+					frame.pending_item.reset();
+
+					if (itemset_.size() >= constraints_.max_length) return false;
+
+					if (subproblem_handler_ && subproblem_handler_(Subproblem{itemset_, frame.conditional_tree, pending_item})) {
+						return false;
+					}
+
+					auto conditional_tree = std::make_shared<ConditionalTree>(GetConditionalTree(pending_item, header_table,
+						GetRanks(frame), minimum_support_, GetConditionalNodesById(), nullptr, &constraints_.forbidden_items));
+					if (conditional_tree->root->first_child) PushTreeFrame(std::move(conditional_tree));
+					return false;
+				}
+
+				while (frame.next_item > frame.first_branch_item) {
+					const auto next_item = --frame.next_item;
+					if (const auto support = header_table[next_item].support; support >= minimum_support_) {
+						itemset_.resize(frame.itemset_size);
+						itemset_.push_back(GetRank(GetRanks(frame), next_item));
+						support_ = support;
+						if (!IsExtensible()) continue;
+						frame.pending_item = next_item;
+						return true;
+					}
+				}
+
+				if (!frame.is_prefix_path_expanded) {
+					frame.is_prefix_path_expanded = true;
+					const auto frequent_prefix_path_end = std::find_if(frame.prefix_path.cbegin(), frame.prefix_path.cend(),
+						[&](const auto* node) { return node->support < minimum_support_; });
+					const auto path_end = static_cast<std::size_t>(frequent_prefix_path_end - frame.prefix_path.cbegin());
+					if (path_end && frame.itemset_size < constraints_.max_length) {
+						path_frames_.push_back({frame.itemset_size, path_end, 0, std::numeric_limits<uint32_t>::max()});
+					}
+					return false;
+				}
+
+				itemset_.resize(frame.itemset_size);
+				tree_frames_.pop_back();
+				return false;
+			}
+
+			/** \brief The support of a combination is that of its deepest node, which is chosen first. */
+			bool NextPathCombination() {
+
+				auto& frame = path_frames_.back();
+
+				if (frame.next_node == frame.path_end) {
+					path_frames_.pop_back();
+					return false;
+				}
+
+				const auto node = tree_frames_.back().prefix_path[frame.next_node];
+				const auto path_end = frame.next_node++;
+
+				itemset_.resize(frame.itemset_size);
+				itemset_.push_back(GetRank(GetRanks(tree_frames_.back()), node->item));
+				support_ = std::min(frame.support, node->support);
+				if (!IsExtensible()) return false;
+
+				if (path_end && itemset_.size() < constraints_.max_length) {
+					path_frames_.push_back({itemset_.size(), path_end, 0, support_});
+				}
+				return true;
+			}
+
+			[[nodiscard]] bool IsExtensible() const {
+
+				const auto item = itemset_.back();
+				if (item < constraints_.forbidden_items.size() && constraints_.forbidden_items[item]) return false;
+
+				for (const auto required_item : constraints_.required_items) {
+					if (required_item > item && std::find(itemset_.cbegin(), itemset_.cend(), required_item) == itemset_.cend()) {
+						return false;
+					}
+				}
+
+				return !constraints_.predicate || constraints_.predicate(itemset_, support_);
+			}
+
+			[[nodiscard]] bool HasRequiredItems() const {
+				return std::all_of(constraints_.required_items.cbegin(), constraints_.required_items.cend(), [&](const auto item) {
+					return std::find(itemset_.cbegin(), itemset_.cend(), item) != itemset_.cend();
+				});
+			}
+
+			const FrequentPatternTreeNode* root_;
+			const HeaderTable* header_table_;
+			uint32_t minimum_support_;
+			RankConstraints constraints_;
+			std::vector<FrequentPatternTreeNode*> owned_conditional_nodes_by_id_;
+			std::vector<FrequentPatternTreeNode*>* conditional_nodes_by_id_ = nullptr;
+			std::function<bool(Subproblem&&)> subproblem_handler_;
+			std::vector<TreeFrame> tree_frames_;
+			std::vector<PathFrame> path_frames_;
+			std::vector<uint32_t> itemset_;
+			uint32_t support_ = 0;
 		};
 
 	public:
+		struct FrequentItemset final {
+			std::unordered_set<T> items;
+			uint32_t support;
+		};
+
+		/** \brief \c predicate must be anti-monotone: when it rejects an itemset it must reject every superset. */
+		struct ItemsetConstraints final {
+			std::size_t min_length = 1;
+			std::size_t max_length = std::numeric_limits<std::size_t>::max();
+			std::unordered_set<T> required_items;
+			std::unordered_set<T> forbidden_items;
+			std::function<bool(const FrequentItemset&)> predicate;
+		};
+
+		/** \brief A single pass range which mines itemsets as it is iterated. It must not outlive its tree. */
+		class FrequentItemsetRange final {
+
+		public:
+			class Iterator final {
+
+			public:
+				using iterator_category = std::input_iterator_tag;
+				using value_type = FrequentItemset;
+				using difference_type = std::ptrdiff_t;
+				using pointer = const FrequentItemset*;
+				using reference = const FrequentItemset&;
+
+				Iterator() = default;
+				explicit Iterator(FrequentItemsetRange* const range) : range_{range} {}
+
+				reference operator*() const { return range_->frequent_itemset_; }
+				pointer operator->() const { return &range_->frequent_itemset_; }
+
+				Iterator& operator++() {
+					range_->Advance();
+					return *this;
+				}
+
+				/** \brief Holds a copy of the itemset the iterator referred to, since advancing overwrites it. */
+				class PostIncrementProxy final {
+
+				public:
+					explicit PostIncrementProxy(FrequentItemset frequent_itemset)
+						: frequent_itemset_{std::move(frequent_itemset)} {}
+
+					reference operator*() const noexcept { return frequent_itemset_; }
+
+				private:
+					FrequentItemset frequent_itemset_;
+				};
+
+				PostIncrementProxy operator++(int) {
+					PostIncrementProxy post_increment_proxy{**this};
+					++*this;
+					return post_increment_proxy;
+				}
+
+				friend bool operator==(const Iterator& a, const Iterator& b) noexcept { return a.IsEnd() == b.IsEnd(); }
+				friend bool operator!=(const Iterator& a, const Iterator& b) noexcept { return !(a == b); }
+
+			private:
+				[[nodiscard]] bool IsEnd() const noexcept { return !range_ || range_->is_exhausted_; }
+
+				FrequentItemsetRange* range_ = nullptr;
+			};
+
+			FrequentItemsetRange(
+				const FrequentPatternTree& frequent_pattern_tree,
+				const uint32_t minimum_support,
+				RankConstraints constraints)
+				: frequent_pattern_tree_{&frequent_pattern_tree},
+				  miner_{*frequent_pattern_tree.root_, frequent_pattern_tree.header_table_,
+					  frequent_pattern_tree.arena_.size(), minimum_support, std::move(constraints)} {}
+
+			Iterator begin() {
+				if (!is_started_) {
+					is_started_ = true;
+					Advance();
+				}
+				return Iterator{this};
+			}
+
+			Iterator end() noexcept { return Iterator{}; }
+
+		private:
+			void Advance() {
+				if (miner_.Next()) {
+					frequent_itemset_ = frequent_pattern_tree_->GetFrequentItemset(miner_.GetItemset(), miner_.GetSupport());
+				} else {
+					is_exhausted_ = true;
+				}
+			}
+
+			const FrequentPatternTree* frequent_pattern_tree_;
+			FrequentItemsetMiner miner_;
+			FrequentItemset frequent_itemset_{};
+			bool is_started_ = false;
+			bool is_exhausted_ = false;
+		};
+
 		FrequentPatternTree() = default;
+		FrequentPatternTree(const FrequentPatternTree&) = delete;
+		FrequentPatternTree& operator=(const FrequentPatternTree&) = delete;
+
+		/** \brief Leaves the source as an empty tree with a root of its own. */
+		FrequentPatternTree(FrequentPatternTree&& frequent_pattern_tree)
+			: items_{std::exchange(frequent_pattern_tree.items_, {})},
+			  item_ranks_{std::exchange(frequent_pattern_tree.item_ranks_, {})},
+			  arena_{std::move(frequent_pattern_tree.arena_)},
+			  root_{std::exchange(frequent_pattern_tree.root_, frequent_pattern_tree.arena_.Create())},
+			  header_table_{std::exchange(frequent_pattern_tree.header_table_, {})},
+			  transaction_count_{std::exchange(frequent_pattern_tree.transaction_count_, 0)},
+			  unsupported_item_count_{std::exchange(frequent_pattern_tree.unsupported_item_count_, 0)},
+			  has_omitted_items_{std::exchange(frequent_pattern_tree.has_omitted_items_, false)} {}
+
+		FrequentPatternTree& operator=(FrequentPatternTree&& frequent_pattern_tree) {
+			if (this != &frequent_pattern_tree) {
+				items_ = std::exchange(frequent_pattern_tree.items_, {});
+				item_ranks_ = std::exchange(frequent_pattern_tree.item_ranks_, {});
+				arena_ = std::move(frequent_pattern_tree.arena_);
+				root_ = std::exchange(frequent_pattern_tree.root_, frequent_pattern_tree.arena_.Create());
+				header_table_ = std::exchange(frequent_pattern_tree.header_table_, {});
+				transaction_count_ = std::exchange(frequent_pattern_tree.transaction_count_, 0);
+				unsupported_item_count_ = std::exchange(frequent_pattern_tree.unsupported_item_count_, 0);
+				has_omitted_items_ = std::exchange(frequent_pattern_tree.has_omitted_items_, false);
+			}
+			return *this;
+		}
 
 		FrequentPatternTree(const std::initializer_list<std::unordered_set<T>>& itemsets)
 			: FrequentPatternTree{std::cbegin(itemsets), std::cend(itemsets)} {}
 
-		template <typename ItemsetIterator> FrequentPatternTree(const ItemsetIterator& begin, const ItemsetIterator& end) {
+		template <typename ItemsetIterator> FrequentPatternTree(const ItemsetIterator& begin, const ItemsetIterator& end)
+			: FrequentPatternTree{begin, end, 1} {}
+
+		/** \brief Omits items occurring fewer than \p minimum_support times, so queries below it are incomplete. */
+		template <typename ItemsetIterator>
+		FrequentPatternTree(const ItemsetIterator& begin, const ItemsetIterator& end, const uint32_t minimum_support) {
+			InitializeItemRanks(GetItemSupport(begin, end), minimum_support);
+			header_table_.resize(items_.size());
+
+			std::vector<uint32_t> itemset_ranks;
+
+			for (auto itemset = begin; itemset != end; ++itemset) {
+				Insert(*itemset, itemset_ranks, *root_, arena_, header_table_);
+				++transaction_count_;
+			}
+		}
+
+		/** \brief Ranks items by descending minimum support so the first item mined in a branch sets its threshold. */
+		template <typename ItemsetIterator>
+		FrequentPatternTree(
+			const ItemsetIterator& begin,
+			const ItemsetIterator& end,
+			const std::unordered_map<T, uint32_t>& item_minimum_supports,
+			const uint32_t default_minimum_support) {
+
 			const auto item_support = GetItemSupport(begin, end);
+			const auto get_item_minimum_support = [&](const T& item) {
+				const auto item_minimum_support = item_minimum_supports.find(item);
+				return item_minimum_support != item_minimum_supports.cend() ? item_minimum_support->second : default_minimum_support;
+			};
+
+			auto lowest_minimum_support = std::numeric_limits<uint32_t>::max();
+			for (const auto& [item, support] : item_support) {
+				lowest_minimum_support = std::min(lowest_minimum_support, get_item_minimum_support(item));
+			}
+
+			std::vector<std::pair<T, uint32_t>> items_by_rank;
+			std::copy_if(item_support.cbegin(), item_support.cend(), std::back_inserter(items_by_rank),
+				[&](const auto& item_support_entry) { return item_support_entry.second >= lowest_minimum_support; });
+
+			std::sort(items_by_rank.begin(), items_by_rank.end(), [&](const auto& a, const auto& b) {
+				const auto a_minimum_support = get_item_minimum_support(a.first);
+				const auto b_minimum_support = get_item_minimum_support(b.first);
+				if (a_minimum_support != b_minimum_support) return a_minimum_support > b_minimum_support;
+				return a.second != b.second ? a.second > b.second : a.first < b.first;
+			});
+
+			AssignItemRanks(items_by_rank);
+			has_omitted_items_ = items_by_rank.size() < item_support.size();
+			header_table_.resize(items_.size());
+
+			std::vector<uint32_t> itemset_ranks;
 
 			for (auto itemset = begin; itemset != end; ++itemset) {
-				Insert(*itemset, item_support);
+				Insert(*itemset, itemset_ranks, *root_, arena_, header_table_);
+				++transaction_count_;
 			}
 		}
 
-		[[nodiscard]] std::vector<std::unordered_set<T>> GetFrequentItemsets(const uint32_t minimum_support) const {
-			return GetFrequentItemsets({}, item_nodes_, minimum_support);
+		template <typename ItemsetIterator>
+		FrequentPatternTree(const ItemsetIterator& begin, const ItemsetIterator& end, ThreadPool& thread_pool)
+			: FrequentPatternTree{begin, end, 1, thread_pool} {}
+
+		template <typename ItemsetIterator>
+		FrequentPatternTree(
+			const ItemsetIterator& begin,
+			const ItemsetIterator& end,
+			const uint32_t minimum_support,
+			ThreadPool& thread_pool) {
+
+			InitializeItemRanks(GetItemSupport(begin, end, thread_pool), minimum_support);
+
+			const auto partial_tree_count = GetSliceCount(begin, end, thread_pool);
+			std::vector<ConditionalTree> partial_trees(partial_tree_count);
+
+			ForEachSlice(begin, end, thread_pool, [&](const auto i, const auto& slice_begin, const auto& slice_end) {
+				auto& partial_tree = partial_trees[i];
+				partial_tree.header_table.resize(items_.size());
+				std::vector<uint32_t> itemset_ranks;
+				for (auto itemset = slice_begin; itemset != slice_end; ++itemset) {
+					Insert(*itemset, itemset_ranks, *partial_tree.root, partial_tree.arena, partial_tree.header_table);
+				}
+			});
+
+			for (std::size_t stride = 1; stride < partial_tree_count; stride *= 2) {
+				for (std::size_t i = 0; i + stride < partial_tree_count; i += 2 * stride) {
+					thread_pool.Submit([&target = partial_trees[i], &source = partial_trees[i + stride]] {
+						Merge(*source.root, *target.root, target.arena, target.header_table);
+						for (uint32_t item = 0; item < target.header_table.size(); ++item) {
+							target.header_table[item].support += source.header_table[item].support;
+						}
+					});
+				}
+				thread_pool.Wait();
+			}
+
+			auto& tree = partial_trees.front();
+			arena_ = std::move(tree.arena);
+			root_ = tree.root;
+			header_table_ = std::move(tree.header_table);
+			transaction_count_ = static_cast<uint32_t>(std::distance(begin, end));
+		}
+
+		/**
+		 * \brief New items are ranked after existing items, which can slow mining until \c Restructure is called.
+		 *        Throws \c std::logic_error if a minimum support omitted items at construction, since their earlier
+		 *        occurrences were never counted.
+		 */
+		template <typename ItemsetIterator> void Insert(const ItemsetIterator& begin, const ItemsetIterator& end) {
+
+			if (has_omitted_items_) throw std::logic_error{"Cannot insert into a tree which omitted items at construction"};
+
+			for (auto itemset = begin; itemset != end; ++itemset) {
+				for (const auto& item : *itemset) {
+					if (item_ranks_.emplace(item, static_cast<uint32_t>(items_.size())).second) items_.push_back(item);
+				}
+			}
+			unsupported_item_count_ += static_cast<uint32_t>(items_.size() - header_table_.size());
+			header_table_.resize(items_.size());
+
+			std::vector<uint32_t> itemset_ranks;
+
+			for (auto itemset = begin; itemset != end; ++itemset) {
+				Insert(*itemset, itemset_ranks, *root_, arena_, header_table_);
+				for (const auto rank : itemset_ranks) {
+					if (header_table_[rank].support == 1) --unsupported_item_count_;
+				}
+				++transaction_count_;
+			}
+		}
+
+		/**
+		 * \brief Items whose support falls to zero are dropped by a restructure once they make up half of the items.
+		 *        Removing an itemset which is not in the tree is undefined.
+		 */
+		template <typename ItemsetIterator> void Remove(const ItemsetIterator& begin, const ItemsetIterator& end) {
+
+			std::vector<uint32_t> itemset_ranks;
+			std::vector<FrequentPatternTreeNode*> removed_nodes;
+
+			for (auto itemset = begin; itemset != end; ++itemset) {
+
+				itemset_ranks.clear();
+				for (const auto& item : *itemset) {
+					if (const auto item_rank = item_ranks_.find(item); item_rank != item_ranks_.cend()) {
+						itemset_ranks.push_back(item_rank->second);
+					}
+				}
+				std::sort(itemset_ranks.begin(), itemset_ranks.end());
+
+				auto node = root_;
+				FrequentPatternTreeNode* first_removed_node = nullptr;
+
+				for (const auto rank : itemset_ranks) {
+					node = arena_.FindChild(*node, rank);
+					--node->support;
+					if (!--header_table_[rank].support) ++unsupported_item_count_;
+
+					if (!node->support) {
+						if (!first_removed_node) first_removed_node = node;
+						(node->previous_item_node ? node->previous_item_node->next_item_node : header_table_[rank].item_nodes) =
+							node->next_item_node;
+						if (node->next_item_node) node->next_item_node->previous_item_node = node->previous_item_node;
+						removed_nodes.push_back(node);
+					}
+				}
+
+				// children never have more support than their parent, so the whole subtree below this node is removed
+				if (first_removed_node) arena_.RemoveChild(*first_removed_node->parent, *first_removed_node);
+
+				--transaction_count_;
+			}
+
+			for (const auto removed_node : removed_nodes) {
+				arena_.Release(removed_node);
+			}
+
+			if (2 * unsupported_item_count_ >= items_.size() && unsupported_item_count_) Restructure();
+		}
+
+		/**
+		 * \brief Reranks items by their current support and drops items which no longer occur. Each distinct itemset in
+		 *        the tree is reinserted once, so the cost is proportional to their total length.
+		 */
+		void Restructure() {
+
+			std::vector<std::pair<T, uint32_t>> items_by_descending_support;
+			items_by_descending_support.reserve(items_.size());
+			for (uint32_t rank = 0; rank < items_.size(); ++rank) {
+				items_by_descending_support.emplace_back(items_[rank], header_table_[rank].support);
+			}
+
+			std::sort(items_by_descending_support.begin(), items_by_descending_support.end(), [](const auto& a, const auto& b) {
+				return a.second != b.second ? a.second > b.second : a.first < b.first;
+			});
+			items_by_descending_support.resize(items_.size() - unsupported_item_count_);
+
+			std::vector<uint32_t> restructured_ranks(items_.size());
+			for (uint32_t rank = 0; rank < items_by_descending_support.size(); ++rank) {
+				restructured_ranks[item_ranks_.at(items_by_descending_support[rank].first)] = rank;
+			}
+
+			ConditionalTree restructured_tree;
+			restructured_tree.header_table.resize(items_by_descending_support.size());
+			std::vector<uint32_t> path;
+
+			for (auto child = root_->first_child; child; child = child->next_sibling) {
+				path.push_back(restructured_ranks[child->item]);
+				InsertRestructuredPaths(*child, restructured_ranks, path, restructured_tree);
+				path.pop_back();
+			}
+
+			items_.clear();
+			item_ranks_.clear();
+			AssignItemRanks(items_by_descending_support);
+
+			arena_ = std::move(restructured_tree.arena);
+			root_ = restructured_tree.root;
+			header_table_ = std::move(restructured_tree.header_table);
+			unsupported_item_count_ = 0;
+		}
+
+		[[nodiscard]] uint32_t GetTransactionCount() const noexcept { return transaction_count_; }
+
+		/**
+		 * \brief Converts a fraction of the itemsets in [0, 1] to an absolute minimum support of at least 1. Throws
+		 *        \c std::invalid_argument for NaN, which has no such conversion.
+		 */
+		[[nodiscard]] uint32_t GetMinimumSupport(const double relative_minimum_support) const {
+
+			if (std::isnan(relative_minimum_support)) throw std::invalid_argument{"The relative minimum support is NaN"};
+
+			const auto transaction_count = static_cast<double>(transaction_count_);
+			const auto clamped_relative_minimum_support = std::clamp(relative_minimum_support, 0.0, 1.0);
+			auto minimum_support = static_cast<uint32_t>(std::ceil(clamped_relative_minimum_support * transaction_count));
+
+			// the product may round up past an exact multiple, in which case one fewer itemset already meets the threshold
+			if (minimum_support > 1 && (minimum_support - 1) / transaction_count >= clamped_relative_minimum_support) {
+				--minimum_support;
+			}
+
+			return std::max(minimum_support, 1u);
+		}
+
+		/** \brief A fractional minimum support would truncate toward zero, so it must go through \c GetMinimumSupport. */
+		template <typename U, typename... Args>
+		std::enable_if_t<std::is_floating_point_v<U>> GetFrequentItemsets(U, Args&&...) const = delete;
+
+		[[nodiscard]] std::vector<FrequentItemset> GetFrequentItemsets(const uint32_t minimum_support) const {
+			return GetFrequentItemsets(minimum_support, ItemsetConstraints{});
+		}
+
+		[[nodiscard]] std::vector<FrequentItemset> GetFrequentItemsets(
+			const uint32_t minimum_support,
+			const ItemsetConstraints& constraints) const {
+
+			std::vector<FrequentItemset> frequent_itemsets;
+
+			GetFrequentItemsets(minimum_support, constraints, [&](FrequentItemset&& frequent_itemset) {
+				frequent_itemsets.push_back(std::move(frequent_itemset));
+			});
+
+			return frequent_itemsets;
+		}
+
+		/** \brief \p sink is invoked once per frequent itemset with an rvalue \c FrequentItemset. */
+		template <
+			typename FrequentItemsetSink,
+			typename = std::enable_if_t<std::is_invocable_v<FrequentItemsetSink&, FrequentItemset&&>>>
+		void GetFrequentItemsets(const uint32_t minimum_support, FrequentItemsetSink&& sink) const {
+			GetFrequentItemsets(minimum_support, ItemsetConstraints{}, sink);
+		}
+
+		template <typename FrequentItemsetSink>
+		void GetFrequentItemsets(
+			const uint32_t minimum_support,
+			const ItemsetConstraints& constraints,
+			FrequentItemsetSink&& sink) const {
+
+			FrequentItemsetMiner miner{
+				*root_, header_table_, arena_.size(), std::max(minimum_support, 1u), GetRankConstraints(constraints)};
+
+			while (miner.Next()) {
+				sink(GetFrequentItemset(miner.GetItemset(), miner.GetSupport()));
+			}
+		}
+
+		/** \brief Large conditional trees below the first level are also mined as separate tasks. */
+		[[nodiscard]] std::vector<FrequentItemset> GetFrequentItemsets(
+			const uint32_t minimum_support,
+			ThreadPool& thread_pool) const {
+
+			if (!minimum_support) return GetFrequentItemsets(1, thread_pool);
+
+			const auto thread_count = thread_pool.GetThreadCount() + 1;
+			std::vector<std::vector<FrequentItemset>> thread_frequent_itemsets(thread_count);
+			std::vector<std::vector<FrequentPatternTreeNode*>> thread_conditional_nodes_by_id(thread_count);
+
+			std::function<void(FrequentItemsetMiner&)> mine = [&](FrequentItemsetMiner& miner) {
+				miner.SetSubproblemHandler([&](Subproblem&& subproblem) {
+					const auto tree_node_count = subproblem.tree ? subproblem.tree->arena.size() : arena_.size();
+					if (subproblem.itemset.size() > 1 && tree_node_count < kMinimumParallelSubproblemNodeCount) return false;
+
+					thread_pool.Submit([&, subproblem = std::make_shared<Subproblem>(std::move(subproblem))] {
+						auto& conditional_nodes_by_id = thread_conditional_nodes_by_id[thread_pool.GetThreadIndex()];
+						conditional_nodes_by_id.resize(arena_.size());
+						FrequentItemsetMiner subproblem_miner{std::move(*subproblem), *root_, header_table_, minimum_support,
+							RankConstraints{}, conditional_nodes_by_id};
+						mine(subproblem_miner);
+					});
+					return true;
+				});
+
+				auto& frequent_itemsets = thread_frequent_itemsets[thread_pool.GetThreadIndex()];
+				while (miner.Next()) {
+					frequent_itemsets.push_back(GetFrequentItemset(miner.GetItemset(), miner.GetSupport()));
+				}
+			};
+
+			thread_pool.Submit([&] {
+				FrequentItemsetMiner miner{*root_, header_table_, arena_.size(), minimum_support, RankConstraints{}};
+				mine(miner);
+			});
+			thread_pool.Wait();
+
+			auto& frequent_itemsets = thread_frequent_itemsets.front();
+			for (auto iterator = std::next(thread_frequent_itemsets.begin()); iterator != thread_frequent_itemsets.end(); ++iterator) {
+				std::move(iterator->begin(), iterator->end(), std::back_inserter(frequent_itemsets));
+			}
+
+			return std::move(frequent_itemsets);
+		}
+
+		template <typename U, typename... Args>
+		std::enable_if_t<std::is_floating_point_v<U>> GetFrequentItemsetRange(U, Args&&...) const = delete;
+
+		[[nodiscard]] FrequentItemsetRange GetFrequentItemsetRange(const uint32_t minimum_support) const {
+			return GetFrequentItemsetRange(minimum_support, ItemsetConstraints{});
+		}
+
+		[[nodiscard]] FrequentItemsetRange GetFrequentItemsetRange(
+			const uint32_t minimum_support,
+			const ItemsetConstraints& constraints) const {
+			return FrequentItemsetRange{*this, std::max(minimum_support, 1u), GetRankConstraints(constraints)};
+		}
+
+		template <typename U, typename... Args>
+		std::enable_if_t<std::is_floating_point_v<U>> GetFrequentItemsets(
+			const std::unordered_map<T, uint32_t>&, U, Args&&...) const = delete;
+
+		/**
+		 * \brief An itemset is frequent if its support is at least the lowest minimum support of its items. Results are
+		 *        only complete on a tree built with the same minimum supports.
+		 */
+		[[nodiscard]] std::vector<FrequentItemset> GetFrequentItemsets(
+			const std::unordered_map<T, uint32_t>& item_minimum_supports,
+			const uint32_t default_minimum_support) const {
+
+			std::vector<FrequentItemset> frequent_itemsets;
+
+			GetFrequentItemsets(item_minimum_supports, default_minimum_support, [&](FrequentItemset&& frequent_itemset) {
+				frequent_itemsets.push_back(std::move(frequent_itemset));
+			});
+
+			return frequent_itemsets;
+		}
+
+		template <typename FrequentItemsetSink>
+		void GetFrequentItemsets(
+			const std::unordered_map<T, uint32_t>& item_minimum_supports,
+			const uint32_t default_minimum_support,
+			FrequentItemsetSink&& sink) const {
+
+			std::vector<uint32_t> minimum_supports(items_.size(), std::max(default_minimum_support, 1u));
+			for (const auto& [item, minimum_support] : item_minimum_supports) {
+				if (const auto item_rank = item_ranks_.find(item); item_rank != item_ranks_.cend()) {
+					minimum_supports[item_rank->second] = std::max(minimum_support, 1u);
+				}
+			}
+
+			// the lowest minimum support of the items ranked ahead of each item, which bounds its extensions
+			std::vector<uint32_t> ahead_minimum_supports(items_.size(), std::numeric_limits<uint32_t>::max());
+			for (uint32_t item = 1; item < items_.size(); ++item) {
+				ahead_minimum_supports[item] = std::min(ahead_minimum_supports[item - 1], minimum_supports[item - 1]);
+			}
+
+			std::vector<FrequentPatternTreeNode*> conditional_nodes_by_id(arena_.size());
+			std::vector<uint32_t> itemset;
+
+			MineItemMinimumSupportItemsets(header_table_, nullptr, minimum_supports, ahead_minimum_supports,
+				std::numeric_limits<uint32_t>::max(), itemset, conditional_nodes_by_id, sink);
+		}
+
+		/** \brief Gets the itemsets without a superset of equal support, which are mined with FP-Close. */
+		template <typename U, typename... Args>
+		std::enable_if_t<std::is_floating_point_v<U>> GetClosedItemsets(U, Args&&...) const = delete;
+
+		[[nodiscard]] std::vector<FrequentItemset> GetClosedItemsets(const uint32_t minimum_support) const {
+
+			std::vector<FrequentItemset> closed_itemsets;
+
+			GetClosedItemsets(minimum_support, [&](FrequentItemset&& closed_itemset) {
+				closed_itemsets.push_back(std::move(closed_itemset));
+			});
+
+			return closed_itemsets;
+		}
+
+		template <typename FrequentItemsetSink>
+		void GetClosedItemsets(const uint32_t minimum_support, FrequentItemsetSink&& sink) const {
+
+			ConditionalTree closed_itemset_tree;
+			closed_itemset_tree.header_table.resize(items_.size());
+			std::vector<FrequentPatternTreeNode*> conditional_nodes_by_id(arena_.size());
+			std::vector<uint32_t> itemset;
+
+			MineClosedItemsets(header_table_, nullptr, std::max(minimum_support, 1u), itemset, closed_itemset_tree,
+				conditional_nodes_by_id, sink);
+		}
+
+		/** \brief Gets the itemsets without a frequent superset, which are mined with FPMax. */
+		template <typename U, typename... Args>
+		std::enable_if_t<std::is_floating_point_v<U>> GetMaximalItemsets(U, Args&&...) const = delete;
+
+		[[nodiscard]] std::vector<FrequentItemset> GetMaximalItemsets(const uint32_t minimum_support) const {
+
+			std::vector<FrequentItemset> maximal_itemsets;
+
+			GetMaximalItemsets(minimum_support, [&](FrequentItemset&& maximal_itemset) {
+				maximal_itemsets.push_back(std::move(maximal_itemset));
+			});
+
+			return maximal_itemsets;
+		}
+
+		template <typename FrequentItemsetSink>
+		void GetMaximalItemsets(const uint32_t minimum_support, FrequentItemsetSink&& sink) const {
+
+			ConditionalTree maximal_itemset_tree;
+			maximal_itemset_tree.header_table.resize(items_.size());
+			std::vector<FrequentPatternTreeNode*> conditional_nodes_by_id(arena_.size());
+			std::vector<uint32_t> itemset;
+
+			MineMaximalItemsets(*root_, header_table_, nullptr, std::max(minimum_support, 1u), itemset,
+				maximal_itemset_tree, conditional_nodes_by_id, sink);
+		}
+
+		/**
+		 * \brief Returns itemsets in order of descending support. Itemsets tied with the lowest support returned may be
+		 *        excluded arbitrarily.
+		 */
+		[[nodiscard]] std::vector<FrequentItemset> GetTopKItemsets(const std::size_t k, const std::size_t min_length = 1) const {
+
+			if (!k) return {};
+
+			// the k-th most frequent item bounds the support of the top itemsets from below when items can be returned
+			uint32_t minimum_support = 1;
+			if (min_length <= 1 && header_table_.size() >= k) {
+				std::vector<uint32_t> item_supports;
+				item_supports.reserve(header_table_.size());
+				for (const auto& header_table_entry : header_table_) item_supports.push_back(header_table_entry.support);
+				std::nth_element(item_supports.begin(), std::next(item_supports.begin(), k - 1), item_supports.end(),
+					std::greater<>{});
+				minimum_support = std::max(minimum_support, item_supports[k - 1]);
+			}
+
+			TopKItemsets top_k_itemsets;
+			std::vector<FrequentPatternTreeNode*> conditional_nodes_by_id(arena_.size());
+			std::vector<uint32_t> itemset;
+
+			MineTopKItemsets(header_table_, nullptr, k, min_length, itemset, top_k_itemsets, minimum_support,
+				conditional_nodes_by_id);
+
+			std::vector<FrequentItemset> frequent_itemsets(top_k_itemsets.size());
+
+			for (auto frequent_itemset = frequent_itemsets.rbegin(); frequent_itemset != frequent_itemsets.rend(); ++frequent_itemset) {
+				const auto& [support, itemset_ranks] = top_k_itemsets.top();
+				*frequent_itemset = GetFrequentItemset(itemset_ranks, support);
+				top_k_itemsets.pop();
+			}
+
+			return frequent_itemsets;
 		}
 
 	private:
+		/** \brief The size of a tree above which the conditional trees projected from it are mined as separate tasks. */
+		static constexpr uint32_t kMinimumParallelSubproblemNodeCount = 1024;
+
+		static constexpr uint32_t kMissingItem = std::numeric_limits<uint32_t>::max();
+
 		template <typename ItemsetIterator>
 		static std::unordered_map<T, uint32_t> GetItemSupport(const ItemsetIterator& begin, const ItemsetIterator& end) {
 
@@ -67,106 +1051,545 @@ namespace fpt {
 			return item_support;
 		}
 
-		void Insert(const std::unordered_set<T>& itemset, const std::unordered_map<T, uint32_t>& item_support) {
+		template <typename ItemsetIterator>
+		static std::unordered_map<T, uint32_t> GetItemSupport(
+			const ItemsetIterator& begin,
+			const ItemsetIterator& end,
+			ThreadPool& thread_pool) {
 
-			std::set<T, std::function<bool(T, T)>> items_by_descending_support{itemset.cbegin(), itemset.cend(),
-				[&](const T& a, const T& b) {
-					return item_support.at(a) != item_support.at(b) ? item_support.at(a) > item_support.at(b) : a < b;
-				}};
+			const auto slice_count = GetSliceCount(begin, end, thread_pool);
+			std::vector<std::unordered_map<T, uint32_t>> slice_item_support(slice_count);
 
-			auto iterator = root_;
+			ForEachSlice(begin, end, thread_pool, [&](const auto i, const auto& slice_begin, const auto& slice_end) {
+				slice_item_support[i] = GetItemSupport(slice_begin, slice_end);
+			});
 
-			for (const auto& item : items_by_descending_support) {
-				if (!iterator->children.count(item)) {
-					iterator->children[item] = std::make_shared<FrequentPatternTreeNode>(item, iterator);
-					item_nodes_.emplace(item, iterator->children[item]);
-				} else {
-					++iterator->children[item]->support;
+			for (std::size_t stride = 1; stride < slice_count; stride *= 2) {
+				for (std::size_t i = 0; i + stride < slice_count; i += 2 * stride) {
+					thread_pool.Submit([&target = slice_item_support[i], &source = slice_item_support[i + stride]] {
+						for (const auto& [item, support] : source) {
+							target[item] += support;
+						}
+					});
 				}
-				iterator = iterator->children[item];
+				thread_pool.Wait();
+			}
+
+			return std::move(slice_item_support.front());
+		}
+
+		template <typename ItemsetIterator>
+		static std::size_t GetSliceCount(const ItemsetIterator& begin, const ItemsetIterator& end, const ThreadPool& thread_pool) {
+			const auto itemset_count = static_cast<std::size_t>(std::distance(begin, end));
+			return std::max(std::size_t{1}, std::min(thread_pool.GetThreadCount(), itemset_count));
+		}
+
+		/** \brief Runs \p task with the index and bounds of each of \c GetSliceCount slices and waits for them. */
+		template <typename ItemsetIterator, typename SliceTask>
+		static void ForEachSlice(
+			const ItemsetIterator& begin,
+			const ItemsetIterator& end,
+			ThreadPool& thread_pool,
+			const SliceTask& task) {
+
+			const auto itemset_count = static_cast<std::size_t>(std::distance(begin, end));
+			const auto slice_count = GetSliceCount(begin, end, thread_pool);
+
+			auto slice_begin = begin;
+			for (std::size_t i = 0; i < slice_count; ++i) {
+				const auto slice_end = std::next(slice_begin,
+					static_cast<std::ptrdiff_t>(itemset_count * (i + 1) / slice_count - itemset_count * i / slice_count));
+				thread_pool.Submit([&task, i, slice_begin, slice_end] { task(i, slice_begin, slice_end); });
+				slice_begin = slice_end;
 			}
+
+			thread_pool.Wait();
+		}
+
+		void InitializeItemRanks(const std::unordered_map<T, uint32_t>& item_support, const uint32_t minimum_support) {
+
+			std::vector<std::pair<T, uint32_t>> items_by_descending_support;
+			std::copy_if(item_support.cbegin(), item_support.cend(), std::back_inserter(items_by_descending_support),
+				[&](const auto& item_support_entry) { return item_support_entry.second >= minimum_support; });
+
+			std::sort(items_by_descending_support.begin(), items_by_descending_support.end(), [](const auto& a, const auto& b) {
+				return a.second != b.second ? a.second > b.second : a.first < b.first;
+			});
+
+			AssignItemRanks(items_by_descending_support);
+			has_omitted_items_ = items_by_descending_support.size() < item_support.size();
 		}
 
-		static std::vector<std::unordered_set<T>> GetFrequentItemsets(
-			const std::unordered_set<T>& current_itemset,
-			const std::unordered_multimap<T, std::shared_ptr<FrequentPatternTreeNode>>& item_nodes,
-			const uint32_t minimum_support) {
+		void AssignItemRanks(const std::vector<std::pair<T, uint32_t>>& items_by_rank) {
+
+			items_.reserve(items_by_rank.size());
+			std::transform(items_by_rank.cbegin(), items_by_rank.cend(), std::back_inserter(items_),
+				[](const auto& item_support_entry) { return item_support_entry.first; });
 
-			std::vector<std::unordered_set<T>> frequent_itemsets;
+			item_ranks_.reserve(items_.size());
+			for (uint32_t rank = 0; rank < items_.size(); ++rank) {
+				item_ranks_.emplace(items_[rank], rank);
+			}
+		}
 
-			for (const auto& next_item : GetUniqueItems(item_nodes)) {
-				if (GetItemSupport(next_item, item_nodes) >= minimum_support) {
+		/** \brief \p itemset_ranks is scratch space reused across insertions. */
+		void Insert(
+			const std::unordered_set<T>& itemset,
+			std::vector<uint32_t>& itemset_ranks,
+			FrequentPatternTreeNode& root,
+			NodeArena& arena,
+			HeaderTable& header_table) const {
 
-					std::unordered_set<T> next_itemset{current_itemset};
-					next_itemset.insert(next_item);
-					frequent_itemsets.push_back(next_itemset);
+			itemset_ranks.clear();
 
-					const auto conditional_item_nodes = GetConditionalItemNodes(next_item, item_nodes);
-					const auto next_itemsets = GetFrequentItemsets(next_itemset, conditional_item_nodes, minimum_support);
-					frequent_itemsets.insert(frequent_itemsets.cend(), next_itemsets.cbegin(), next_itemsets.cend());
+			for (const auto& item : itemset) {
+				if (const auto item_rank = item_ranks_.find(item); item_rank != item_ranks_.cend()) {
+					itemset_ranks.push_back(item_rank->second);
 				}
 			}
 
-			return frequent_itemsets;
+			std::sort(itemset_ranks.begin(), itemset_ranks.end());
+			InsertPath(itemset_ranks, 1, root, arena, header_table);
 		}
 
-		static std::unordered_set<T> GetUniqueItems(
-			const std::unordered_multimap<T, std::shared_ptr<FrequentPatternTreeNode>>& item_nodes) {
+		static void InsertPath(
+			const std::vector<uint32_t>& path,
+			const uint32_t support,
+			FrequentPatternTreeNode& root,
+			NodeArena& arena,
+			HeaderTable& header_table) {
 
-			std::unordered_set<T> unique_items;
+			auto iterator = &root;
 
-			std::transform(item_nodes.cbegin(), item_nodes.cend(), std::inserter(unique_items, std::end(unique_items)),
-				[](const auto& map_entry) { return map_entry.first; });
+			for (const auto rank : path) {
+				iterator = FindOrCreateChild(*iterator, rank, arena, header_table);
+				iterator->support += support;
+				header_table[rank].support += support;
+			}
+		}
 
-			return unique_items;
+		/**
+		 * \brief Reinserts the itemsets ending at or below \p node into \p restructured_tree. \p path holds the
+		 *        restructured ranks of \p node and its ancestors in ascending order.
+		 */
+		static void InsertRestructuredPaths(
+			const FrequentPatternTreeNode& node,
+			const std::vector<uint32_t>& restructured_ranks,
+			std::vector<uint32_t>& path,
+			ConditionalTree& restructured_tree) {
+
+			// itemsets ending at a node are not counted by its children
+			auto path_support = node.support;
+
+			for (auto child = node.first_child; child; child = child->next_sibling) {
+				path_support -= child->support;
+
+				const auto rank = restructured_ranks[child->item];
+				const auto position = std::upper_bound(path.cbegin(), path.cend(), rank) - path.cbegin();
+				path.insert(path.cbegin() + position, rank);
+				InsertRestructuredPaths(*child, restructured_ranks, path, restructured_tree);
+				path.erase(path.cbegin() + position);
+			}
+
+			if (path_support) {
+				InsertPath(path, path_support, *restructured_tree.root, restructured_tree.arena, restructured_tree.header_table);
+			}
+		}
+
+		/** \brief Both trees must share item ranks. Header table supports are left to the caller. */
+		static void Merge(
+			const FrequentPatternTreeNode& source,
+			FrequentPatternTreeNode& target,
+			NodeArena& arena,
+			HeaderTable& header_table) {
+
+			for (auto source_child = source.first_child; source_child; source_child = source_child->next_sibling) {
+				const auto target_child = FindOrCreateChild(target, source_child->item, arena, header_table);
+				target_child->support += source_child->support;
+				Merge(*source_child, *target_child, arena, header_table);
+			}
+		}
+
+		static FrequentPatternTreeNode* FindOrCreateChild(
+			FrequentPatternTreeNode& node,
+			const uint32_t item,
+			NodeArena& arena,
+			HeaderTable& header_table) {
+
+			if (const auto child = arena.FindChild(node, item)) return child;
+
+			const auto child = arena.Create(item, &node);
+			arena.AddChild(node, *child);
+			child->next_item_node = header_table[item].item_nodes;
+			if (child->next_item_node) child->next_item_node->previous_item_node = child;
+			header_table[item].item_nodes = child;
+
+			return child;
+		}
+
+		/** \brief The itemsets drawn from this path alone are its combinations and need no conditional trees. */
+		static std::vector<const FrequentPatternTreeNode*> GetSinglePrefixPath(const FrequentPatternTreeNode& root) {
+
+			std::vector<const FrequentPatternTreeNode*> prefix_path;
+
+			for (auto node = root.first_child; node && !node->next_sibling; node = node->first_child) {
+				prefix_path.push_back(node);
+			}
+
+			return prefix_path;
+		}
+
+		/**
+		 * \brief Items are counted before the prefix paths are inserted so the remaining items can be numbered densely.
+		 *        \p conditional_nodes_by_id maps a node id to the conditional node ending its pruned prefix path, which
+		 *        lets paths skip their shared ancestors, and is reset before returning. Closure and excluded items are
+		 *        ranks of the frequent pattern tree.
+		 */
+		static ConditionalTree GetConditionalTree(
+			const uint32_t target,
+			const HeaderTable& header_table,
+			const std::vector<uint32_t>* const ranks,
+			const uint32_t minimum_support,
+			std::vector<FrequentPatternTreeNode*>& conditional_nodes_by_id,
+			std::vector<uint32_t>* const closure_items = nullptr,
+			const std::vector<bool>* const excluded_items = nullptr) {
+
+			// ancestors always rank before their descendants so only items ranked ahead of the target can appear
+			std::vector<uint32_t> item_support(target);
+
+			for (auto target_node = header_table[target].item_nodes; target_node; target_node = target_node->next_item_node) {
+				for (auto node = target_node->parent; node->parent; node = node->parent) {
+					item_support[node->item] += target_node->support;
+				}
+			}
+
+			ConditionalTree conditional_tree;
+			auto& conditional_header_table = conditional_tree.header_table;
+			std::vector<uint32_t> conditional_items(target, kMissingItem);
+
+			for (uint32_t item = 0; item < target; ++item) {
+				const auto support = item_support[item];
+				const auto rank = GetRank(ranks, item);
+				if (support < minimum_support || (excluded_items && rank < excluded_items->size() && (*excluded_items)[rank])) {
+					continue;
+				}
+				if (closure_items && support == header_table[target].support) {
+					closure_items->push_back(rank);
+					continue;
+				}
+				conditional_items[item] = static_cast<uint32_t>(conditional_header_table.size());
+				conditional_header_table.push_back({support, nullptr});
+				conditional_tree.ranks.push_back(rank);
+			}
+
+			std::vector<const FrequentPatternTreeNode*> prefix_path;
+
+			for (auto target_node = header_table[target].item_nodes; target_node; target_node = target_node->next_item_node) {
+
+				auto node = target_node->parent;
+				for (; node->parent && !conditional_nodes_by_id[node->id]; node = node->parent) {
+					prefix_path.push_back(node);
+				}
+
+				auto conditional_node = node->parent ? conditional_nodes_by_id[node->id] : conditional_tree.root;
+				for (; !prefix_path.empty(); prefix_path.pop_back()) {
+					const auto prefix_node = prefix_path.back();
+					if (const auto conditional_item = conditional_items[prefix_node->item]; conditional_item != kMissingItem) {
+						conditional_node =
+							FindOrCreateChild(*conditional_node, conditional_item, conditional_tree.arena, conditional_header_table);
+					}
+					conditional_nodes_by_id[prefix_node->id] = conditional_node;
+				}
+
+				for (auto ancestor = conditional_node; ancestor->parent; ancestor = ancestor->parent) {
+					ancestor->support += target_node->support;
+				}
+			}
+
+			for (auto target_node = header_table[target].item_nodes; target_node; target_node = target_node->next_item_node) {
+				for (auto node = target_node->parent; node->parent && conditional_nodes_by_id[node->id]; node = node->parent) {
+					conditional_nodes_by_id[node->id] = nullptr;
+				}
+			}
+
+			return conditional_tree;
+		}
+
+		/** \brief Gets the rank of an item of a tree whose item ranks are \p ranks, or are the items themselves if null. */
+		static uint32_t GetRank(const std::vector<uint32_t>* const ranks, const uint32_t item) noexcept {
+			return ranks ? (*ranks)[item] : item;
+		}
+
+		/**
+		 * \brief A branch whose closure is covered by a closed itemset of equal support is skipped. The nodes of
+		 *        \p closed_itemset_tree hold the largest support of any closed itemset passing through them.
+		 */
+		template <typename FrequentItemsetSink>
+		void MineClosedItemsets(
+			const HeaderTable& header_table,
+			const std::vector<uint32_t>* const ranks,
+			const uint32_t minimum_support,
+			std::vector<uint32_t>& itemset,
+			ConditionalTree& closed_itemset_tree,
+			std::vector<FrequentPatternTreeNode*>& conditional_nodes_by_id,
+			FrequentItemsetSink& sink) const {
+
+			const auto itemset_size = itemset.size();
+			std::vector<uint32_t> sorted_itemset;
+
+			for (auto item = static_cast<uint32_t>(header_table.size()); item-- > 0;) {
+				const auto support = header_table[item].support;
+				if (support < minimum_support) continue;
+
+				itemset.push_back(GetRank(ranks, item));
+				auto conditional_tree = GetConditionalTree(
+					item, header_table, ranks, minimum_support, conditional_nodes_by_id, &itemset);
+
+				sorted_itemset = itemset;
+				std::sort(sorted_itemset.begin(), sorted_itemset.end());
+
+				if (!ContainsSuperset(closed_itemset_tree, sorted_itemset, support)) {
+					InsertItemset(closed_itemset_tree, sorted_itemset, support);
+					sink(GetFrequentItemset(itemset, support));
+
+					if (conditional_tree.root->first_child) {
+						MineClosedItemsets(conditional_tree.header_table, &conditional_tree.ranks, minimum_support, itemset,
+							closed_itemset_tree, conditional_nodes_by_id, sink);
+					}
+				}
+
+				itemset.resize(itemset_size);
+			}
 		}
 
-		static uint32_t GetItemSupport(
-			const T& item,
-			const std::unordered_multimap<T, std::shared_ptr<FrequentPatternTreeNode>>& item_nodes) {
+		/**
+		 * \brief An extension can only lower the threshold to the lowest minimum support ranked ahead of its new item,
+		 *        so each branch is pruned and projected at that bound.
+		 */
+		template <typename FrequentItemsetSink>
+		void MineItemMinimumSupportItemsets(
+			const HeaderTable& header_table,
+			const std::vector<uint32_t>* const ranks,
+			const std::vector<uint32_t>& minimum_supports,
+			const std::vector<uint32_t>& ahead_minimum_supports,
+			const uint32_t itemset_minimum_support,
+			std::vector<uint32_t>& itemset,
+			std::vector<FrequentPatternTreeNode*>& conditional_nodes_by_id,
+			FrequentItemsetSink& sink) const {
+
+			for (auto item = static_cast<uint32_t>(header_table.size()); item-- > 0;) {
+				const auto support = header_table[item].support;
+				const auto rank = GetRank(ranks, item);
+				const auto minimum_support = std::min(itemset_minimum_support, minimum_supports[rank]);
+				const auto branch_minimum_support = std::min(minimum_support, ahead_minimum_supports[rank]);
+				if (support < branch_minimum_support) continue;
 
-			const auto item_range = item_nodes.equal_range(item);
+				itemset.push_back(rank);
+				if (support >= minimum_support) sink(GetFrequentItemset(itemset, support));
 
-			return std::transform_reduce(item_range.first, item_range.second, uint32_t{0}, std::plus<uint32_t>{},
-				[](const auto& map_entry) { return map_entry.second->support; });
+				auto conditional_tree = GetConditionalTree(
+					item, header_table, ranks, branch_minimum_support, conditional_nodes_by_id);
+				if (conditional_tree.root->first_child) {
+					MineItemMinimumSupportItemsets(conditional_tree.header_table, &conditional_tree.ranks, minimum_supports,
+						ahead_minimum_supports, minimum_support, itemset, conditional_nodes_by_id, sink);
+				}
+
+				itemset.pop_back();
+			}
 		}
 
-		static std::unordered_multimap<T, std::shared_ptr<FrequentPatternTreeNode>> GetConditionalItemNodes(
-			const T& target,
-			const std::unordered_multimap<T, std::shared_ptr<FrequentPatternTreeNode>>& item_nodes) {
+		/** \brief A min heap of the supports and item ranks of the best itemsets found by a top-k query. */
+		using TopKItemsets = std::priority_queue<
+			std::pair<uint32_t, std::vector<uint32_t>>,
+			std::vector<std::pair<uint32_t, std::vector<uint32_t>>>,
+			std::greater<>>;
+
+		/** \brief \p minimum_support rises as the heap fills, so an item below it ends its branch. */
+		void MineTopKItemsets(
+			const HeaderTable& header_table,
+			const std::vector<uint32_t>* const ranks,
+			const std::size_t k,
+			const std::size_t min_length,
+			std::vector<uint32_t>& itemset,
+			TopKItemsets& top_k_itemsets,
+			uint32_t& minimum_support,
+			std::vector<FrequentPatternTreeNode*>& conditional_nodes_by_id) const {
 
-			std::unordered_multimap<T, std::shared_ptr<FrequentPatternTreeNode>> conditional_item_nodes;
-			const auto target_range = item_nodes.equal_range(target);
+			for (uint32_t item = 0; item < header_table.size(); ++item) {
+				const auto support = header_table[item].support;
+				if (support < minimum_support) continue;
 
-			for (auto target_iterator = target_range.first; target_iterator != target_range.second; ++target_iterator) {
-				for (auto node = target_iterator->second->parent; node->parent; node = node->parent) {
+				itemset.push_back(GetRank(ranks, item));
 
-					if (auto item_node = FindItemNode(*node, conditional_item_nodes); item_node) {
-						item_node->support += target_iterator->second->support;
+				if (itemset.size() >= min_length) {
+					top_k_itemsets.emplace(support, itemset);
+					if (top_k_itemsets.size() > k) top_k_itemsets.pop();
+					if (top_k_itemsets.size() == k) {
+						minimum_support = std::max(minimum_support, top_k_itemsets.top().first + 1);
+					}
+				}
+
+				if (support >= minimum_support) {
+					auto conditional_tree = GetConditionalTree(
+						item, header_table, ranks, minimum_support, conditional_nodes_by_id);
+					if (conditional_tree.root->first_child) {
+						MineTopKItemsets(conditional_tree.header_table, &conditional_tree.ranks, k, min_length, itemset,
+							top_k_itemsets, minimum_support, conditional_nodes_by_id);
+					}
+				}
+
+				itemset.pop_back();
+			}
+		}
+
+		/** \brief Skips a branch if it and every frequent item of its conditional tree are covered by a maximal itemset. */
+		template <typename FrequentItemsetSink>
+		void MineMaximalItemsets(
+			const FrequentPatternTreeNode& root,
+			const HeaderTable& header_table,
+			const std::vector<uint32_t>* const ranks,
+			const uint32_t minimum_support,
+			std::vector<uint32_t>& itemset,
+			ConditionalTree& maximal_itemset_tree,
+			std::vector<FrequentPatternTreeNode*>& conditional_nodes_by_id,
+			FrequentItemsetSink& sink) const {
+
+			const auto itemset_size = itemset.size();
+			std::vector<uint32_t> sorted_itemset;
+
+			const auto add_maximal_itemset = [&](const uint32_t support) {
+				sorted_itemset = itemset;
+				std::sort(sorted_itemset.begin(), sorted_itemset.end());
+				if (ContainsSuperset(maximal_itemset_tree, sorted_itemset, 0)) return;
+				InsertItemset(maximal_itemset_tree, sorted_itemset, support);
+				sink(GetFrequentItemset(itemset, support));
+			};
+
+			if (const auto prefix_path = GetSinglePrefixPath(root); !prefix_path.empty() && !prefix_path.back()->first_child) {
+				auto support = std::numeric_limits<uint32_t>::max();
+				for (const auto* node : prefix_path) {
+					if (node->support < minimum_support) break;
+					itemset.push_back(GetRank(ranks, node->item));
+					support = node->support;
+				}
+				if (itemset.size() > itemset_size) add_maximal_itemset(support);
+				itemset.resize(itemset_size);
+				return;
+			}
+
+			for (auto item = static_cast<uint32_t>(header_table.size()); item-- > 0;) {
+				const auto support = header_table[item].support;
+				if (support < minimum_support) continue;
+
+				itemset.push_back(GetRank(ranks, item));
+				auto conditional_tree = GetConditionalTree(
+					item, header_table, ranks, minimum_support, conditional_nodes_by_id, &itemset);
+
+				// look ahead to the largest itemset this branch could produce, which holds every conditional item
+				sorted_itemset = itemset;
+				sorted_itemset.insert(sorted_itemset.end(), conditional_tree.ranks.cbegin(), conditional_tree.ranks.cend());
+				std::sort(sorted_itemset.begin(), sorted_itemset.end());
+
+				if (!ContainsSuperset(maximal_itemset_tree, sorted_itemset, 0)) {
+					if (conditional_tree.root->first_child) {
+						MineMaximalItemsets(*conditional_tree.root, conditional_tree.header_table, &conditional_tree.ranks,
+							minimum_support, itemset, maximal_itemset_tree, conditional_nodes_by_id, sink);
 					} else {
-						item_node = std::make_shared<FrequentPatternTreeNode>(*node);
-						item_node->support = target_iterator->second->support;
-						conditional_item_nodes.emplace(*node->item, item_node);
+						add_maximal_itemset(support);
 					}
 				}
+
+				itemset.resize(itemset_size);
 			}
+		}
 
-			return conditional_item_nodes;
+		/** \brief Only nodes of the last item need to be checked since the rest of a superset must lie above them. */
+		static bool ContainsSuperset(
+			const ConditionalTree& itemset_tree,
+			const std::vector<uint32_t>& itemset,
+			const uint32_t support) {
+
+			for (auto node = itemset_tree.header_table[itemset.back()].item_nodes; node; node = node->next_item_node) {
+				if (node->support < support) continue;
+
+				auto item = std::next(itemset.crbegin());
+				for (auto ancestor = node->parent; ancestor->parent && item != itemset.crend(); ancestor = ancestor->parent) {
+					if (ancestor->item == *item) {
+						++item;
+					} else if (ancestor->item < *item) {
+						break;
+					}
+				}
+
+				if (item == itemset.crend()) return true;
+			}
+
+			return false;
+		}
+
+		/** \brief Raises the support of each node along the path of \p itemset to at least \p support. */
+		static void InsertItemset(ConditionalTree& itemset_tree, const std::vector<uint32_t>& itemset, const uint32_t support) {
+
+			auto node = itemset_tree.root;
+
+			for (const auto item : itemset) {
+				node = FindOrCreateChild(*node, item, itemset_tree.arena, itemset_tree.header_table);
+				node->support = std::max(node->support, support);
+			}
+		}
+
+		RankConstraints GetRankConstraints(const ItemsetConstraints& constraints) const {
+
+			RankConstraints rank_constraints;
+			rank_constraints.min_length = constraints.min_length;
+			rank_constraints.max_length = constraints.max_length;
+
+			for (const auto& item : constraints.required_items) {
+				if (const auto item_rank = item_ranks_.find(item); item_rank != item_ranks_.cend()) {
+					rank_constraints.required_items.push_back(item_rank->second);
+				} else {
+					// a required item which is not in the tree can never be satisfied
+					rank_constraints.max_length = 0;
+				}
+			}
+
+			if (!constraints.forbidden_items.empty()) {
+				rank_constraints.forbidden_items.resize(items_.size());
+				for (const auto& item : constraints.forbidden_items) {
+					if (const auto item_rank = item_ranks_.find(item); item_rank != item_ranks_.cend()) {
+						rank_constraints.forbidden_items[item_rank->second] = true;
+					}
+				}
+			}
+
+			if (constraints.predicate) {
+				rank_constraints.predicate = [this, predicate = constraints.predicate](
+					const std::vector<uint32_t>& itemset_ranks, const uint32_t support) {
+					return predicate(GetFrequentItemset(itemset_ranks, support));
+				};
+			}
+
+			return rank_constraints;
 		}
 
-		static std::shared_ptr<FrequentPatternTreeNode> FindItemNode(
-			const FrequentPatternTreeNode& item_node,
-			const std::unordered_multimap<T, std::shared_ptr<FrequentPatternTreeNode>>& item_nodes) {
+		FrequentItemset GetFrequentItemset(const std::vector<uint32_t>& itemset_ranks, const uint32_t support) const {
+
+			FrequentItemset frequent_itemset{std::unordered_set<T>(itemset_ranks.size()), support};
 
-			const auto item = *item_node.item;
-			const auto item_range = item_nodes.equal_range(item);
-			const auto item_range_iterator = std::find_if(item_range.first, item_range.second,
-				[&](const auto& map_entry) { return item_node.id == map_entry.second->id; });
+			for (const auto rank : itemset_ranks) {
+				frequent_itemset.items.insert(items_[rank]);
+			}
 
-			return item_range_iterator != item_range.second ? item_range_iterator->second : nullptr;
+			return frequent_itemset;
 		}
 
-		std::shared_ptr<FrequentPatternTreeNode> root_ = std::make_shared<FrequentPatternTreeNode>();
-		std::unordered_multimap<T, std::shared_ptr<FrequentPatternTreeNode>> item_nodes_;
+		std::vector<T> items_;
+		std::unordered_map<T, uint32_t> item_ranks_;
+		NodeArena arena_;
+		FrequentPatternTreeNode* root_ = arena_.Create();
+		HeaderTable header_table_;
+		uint32_t transaction_count_ = 0;
+		uint32_t unsupported_item_count_ = 0;
+		bool has_omitted_items_ = false;
 	};
 }
@@ -0,0 +1,81 @@
+#pragma once
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <iterator>
+#include <limits>
+#include <type_traits>
+#include <unordered_set>
+#include <utility>
+#include <vector>
+
+#include "frequent_pattern_tree.hpp"
+
+namespace fpt {
+
+	/**
+	 * \brief Like a CanTree, items keep the rank they were first seen with, so expired itemsets are removed by
+	 *        decrementing their paths rather than rebuilding the tree.
+	 */
+	template <typename T, typename Clock = std::chrono::steady_clock> class FrequentPatternWindow final {
+
+	public:
+		using TimePoint = typename Clock::time_point;
+		using Duration = typename Clock::duration;
+
+		explicit FrequentPatternWindow(
+			const std::size_t max_itemset_count = std::numeric_limits<std::size_t>::max(),
+			const Duration max_age = Duration::max())
+			: max_itemset_count_{max_itemset_count},
+			  max_age_{max_age} {}
+
+		/** \brief Times are expected to be non-decreasing. */
+		void Insert(std::unordered_set<T> itemset, const TimePoint time = Clock::now()) {
+			itemsets_.push_back(std::move(itemset));
+			times_.push_back(time);
+			frequent_pattern_tree_.Insert(std::prev(itemsets_.cend()), itemsets_.cend());
+			Expire(time);
+		}
+
+		void Expire(const TimePoint time) {
+
+			std::size_t expired_itemset_count = 0;
+
+			while (expired_itemset_count < itemsets_.size()
+				&& (itemsets_.size() - expired_itemset_count > max_itemset_count_
+					|| time - times_[expired_itemset_count] > max_age_)) {
+				++expired_itemset_count;
+			}
+
+			if (!expired_itemset_count) return;
+
+			const auto expired_itemsets_end = std::next(itemsets_.cbegin(), expired_itemset_count);
+			frequent_pattern_tree_.Remove(itemsets_.cbegin(), expired_itemsets_end);
+			itemsets_.erase(itemsets_.cbegin(), expired_itemsets_end);
+			times_.erase(times_.cbegin(), std::next(times_.cbegin(), expired_itemset_count));
+		}
+
+		[[nodiscard]] const FrequentPatternTree<T>& GetFrequentPatternTree() const noexcept {
+			return frequent_pattern_tree_;
+		}
+
+		[[nodiscard]] std::size_t size() const noexcept { return itemsets_.size(); }
+
+		template <typename U>
+		std::enable_if_t<std::is_floating_point_v<U>> GetFrequentItemsets(U) const = delete;
+
+		[[nodiscard]] std::vector<typename FrequentPatternTree<T>::FrequentItemset> GetFrequentItemsets(
+			const uint32_t minimum_support) const {
+			return frequent_pattern_tree_.GetFrequentItemsets(minimum_support);
+		}
+
+	private:
+		std::size_t max_itemset_count_;
+		Duration max_age_;
+		std::deque<std::unordered_set<T>> itemsets_;
+		std::deque<TimePoint> times_;
+		FrequentPatternTree<T> frequent_pattern_tree_;
+	};
+}
@@ -0,0 +1,170 @@
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace fpt {
+
+	/**
+	 * \brief Workers run the tasks they submit most recent first and steal the oldest tasks from other queues when
+	 *        idle. Tasks submitted from outside the pool go to a shared queue.
+	 */
+	class ThreadPool final {
+
+	public:
+		explicit ThreadPool(const std::size_t thread_count = std::max(1u, std::thread::hardware_concurrency())) {
+
+			for (std::size_t i = 0; i <= thread_count; ++i) {
+				task_queues_.push_back(std::make_unique<TaskQueue>());
+			}
+
+			threads_.reserve(thread_count);
+			for (std::size_t i = 0; i < thread_count; ++i) {
+				threads_.emplace_back([this, i] { Work(i); });
+			}
+		}
+
+		ThreadPool(const ThreadPool&) = delete;
+		ThreadPool(ThreadPool&&) noexcept = delete;
+		ThreadPool& operator=(const ThreadPool&) = delete;
+		ThreadPool& operator=(ThreadPool&&) noexcept = delete;
+
+		~ThreadPool() {
+			Wait();
+			{
+				std::lock_guard lock{mutex_};
+				is_stopping_ = true;
+			}
+			condition_.notify_all();
+
+			for (auto& thread : threads_) {
+				thread.join();
+			}
+		}
+
+		[[nodiscard]] std::size_t GetThreadCount() const noexcept { return threads_.size(); }
+
+		/** \brief Workers have an index in [0, GetThreadCount()) and any other thread has GetThreadCount(). */
+		[[nodiscard]] std::size_t GetThreadIndex() const noexcept {
+			return current_thread_pool_ == this ? current_thread_index_ : threads_.size();
+		}
+
+		template <typename Task> void Submit(Task&& task) {
+
+			pending_task_count_.fetch_add(1);
+			{
+				auto& task_queue = *task_queues_[GetThreadIndex()];
+				std::lock_guard lock{task_queue.mutex};
+				task_queue.tasks.emplace_back(std::forward<Task>(task));
+			}
+			queued_task_count_.fetch_add(1);
+
+			if (waiting_thread_count_.load() > 0) {
+				std::lock_guard lock{mutex_};
+				condition_.notify_all();
+			}
+		}
+
+		/** \brief Runs tasks on the calling thread until every task has completed. Must not be called from a task. */
+		void Wait() {
+
+			const auto thread_index = GetThreadIndex();
+
+			while (pending_task_count_.load() > 0) {
+				if (!TryRunTask(thread_index)) {
+					WaitFor([this] { return pending_task_count_.load() == 0 || queued_task_count_.load() > 0; });
+				}
+			}
+		}
+
+	private:
+		struct TaskQueue final {
+			std::mutex mutex;
+			std::deque<std::function<void()>> tasks;
+		};
+
+		void Work(const std::size_t thread_index) {
+
+			current_thread_pool_ = this;
+			current_thread_index_ = thread_index;
+
+			while (true) {
+				if (TryRunTask(thread_index)) continue;
+
+				WaitFor([this] { return is_stopping_ || queued_task_count_.load() > 0; });
+
+				std::lock_guard lock{mutex_};
+				if (is_stopping_ && queued_task_count_.load() == 0) break;
+			}
+		}
+
+		bool TryRunTask(const std::size_t thread_index) {
+
+			std::function<void()> task;
+
+			if (!TryPopTask(thread_index, task)) return false;
+
+			task();
+			task = nullptr;
+
+			if (pending_task_count_.fetch_sub(1) == 1) {
+				std::lock_guard lock{mutex_};
+				condition_.notify_all();
+			}
+
+			return true;
+		}
+
+		bool TryPopTask(const std::size_t thread_index, std::function<void()>& task) {
+
+			for (std::size_t i = 0; i < task_queues_.size(); ++i) {
+				const auto is_own_queue = i == 0;
+				auto& task_queue = *task_queues_[(thread_index + i) % task_queues_.size()];
+
+				std::lock_guard lock{task_queue.mutex};
+				if (task_queue.tasks.empty()) continue;
+
+				if (is_own_queue) {
+					task = std::move(task_queue.tasks.back());
+					task_queue.tasks.pop_back();
+				} else {
+					task = std::move(task_queue.tasks.front());
+					task_queue.tasks.pop_front();
+				}
+
+				queued_task_count_.fetch_sub(1);
+				return true;
+			}
+
+			return false;
+		}
+
+		template <typename Predicate> void WaitFor(const Predicate& predicate) {
+			std::unique_lock lock{mutex_};
+			waiting_thread_count_.fetch_add(1);
+			condition_.wait(lock, predicate);
+			waiting_thread_count_.fetch_sub(1);
+		}
+
+		static inline thread_local const ThreadPool* current_thread_pool_ = nullptr;
+		static inline thread_local std::size_t current_thread_index_ = 0;
+
+		std::vector<std::unique_ptr<TaskQueue>> task_queues_;
+		std::vector<std::thread> threads_;
+		std::atomic<std::size_t> pending_task_count_{0};
+		std::atomic<std::size_t> queued_task_count_{0};
+		std::atomic<std::size_t> waiting_thread_count_{0};
+		std::mutex mutex_;
+		std::condition_variable condition_;
+		bool is_stopping_ = false;
+	};
+}
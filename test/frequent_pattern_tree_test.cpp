@@ -2,8 +2,27 @@
 
 #include "catch.hpp"
 #include "frequent_pattern_tree.hpp"
+#include "test_utilities.hpp"
+
+#include <limits>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <type_traits>
+#include <utility>
 
 using namespace fpt;
+using namespace fpt::test;
+
+namespace {
+
+	template <typename MinimumSupport, typename = void> struct IsMinimumSupport : std::false_type {};
+
+	template <typename MinimumSupport>
+	struct IsMinimumSupport<MinimumSupport, std::void_t<decltype(
+		std::declval<const FrequentPatternTree<char>&>().GetFrequentItemsets(std::declval<MinimumSupport>()))>>
+		: std::true_type {};
+}
 
 SCENARIO("Frequent Itemset Generation", "[frequent_pattern_tree]") {
 
@@ -39,12 +58,38 @@ SCENARIO("Frequent Itemset Generation", "[frequent_pattern_tree]") {
 
 			THEN("The frequent itemsets contains the itemset {'A'}") {
 				const auto itemset = std::unordered_set<char>{'A'};
-				const auto iterator = std::find(frequent_itemsets.begin(), frequent_itemsets.end(), itemset);
+				const auto iterator = std::find_if(frequent_itemsets.begin(), frequent_itemsets.end(),
+					[&](const auto& frequent_itemset) { return frequent_itemset.items == itemset; });
 				REQUIRE(iterator != frequent_itemsets.end());
 			}
 		}
 	}
 
+	GIVEN("A frequent pattern tree constructed from itemsets where some items never occur together") {
+		const FrequentPatternTree<char> frequent_pattern_tree{{'A', 'B'}, {'A', 'B'}, {'A', 'C'}};
+
+		WHEN("Frequent itemsets are extracted with a minimum support of 0") {
+			const auto frequent_itemsets = frequent_pattern_tree.GetFrequentItemsets(0);
+
+			THEN("The frequent itemsets are the same as those with a minimum support of 1") {
+				REQUIRE(frequent_itemsets.size() == 5);
+				REQUIRE(frequent_pattern_tree.GetFrequentItemsets(1).size() == 5);
+				REQUIRE(std::none_of(frequent_itemsets.cbegin(), frequent_itemsets.cend(),
+					[](const auto& frequent_itemset) { return frequent_itemset.support == 0; }));
+			}
+		}
+
+		WHEN("Frequent itemsets are extracted lazily or in parallel with a minimum support of 0") {
+			auto frequent_itemset_range = frequent_pattern_tree.GetFrequentItemsetRange(0);
+			ThreadPool thread_pool{2};
+
+			THEN("The frequent itemsets are the same as those with a minimum support of 1") {
+				REQUIRE(std::distance(frequent_itemset_range.begin(), frequent_itemset_range.end()) == 5);
+				REQUIRE(frequent_pattern_tree.GetFrequentItemsets(0, thread_pool).size() == 5);
+			}
+		}
+	}
+
 	GIVEN("A frequent pattern tree constructed from a single itemset containing multiple unique elements") {
 		const FrequentPatternTree<char> frequent_pattern_tree{{'A', 'B', 'C'}};
 
@@ -65,43 +110,50 @@ SCENARIO("Frequent Itemset Generation", "[frequent_pattern_tree]") {
 
 			THEN("The frequent itemsets contains the itemset {'A'}") {
 				const auto itemset = std::unordered_set<char>{'A'};
-				const auto iterator = std::find(frequent_itemsets.begin(), frequent_itemsets.end(), itemset);
+				const auto iterator = std::find_if(frequent_itemsets.begin(), frequent_itemsets.end(),
+					[&](const auto& frequent_itemset) { return frequent_itemset.items == itemset; });
 				REQUIRE(iterator != frequent_itemsets.end());
 			}
 
 			THEN("The frequent itemsets contains the itemset {'B'}") {
 				const auto itemset = std::unordered_set<char>{'B'};
-				const auto iterator = std::find(frequent_itemsets.begin(), frequent_itemsets.end(), itemset);
+				const auto iterator = std::find_if(frequent_itemsets.begin(), frequent_itemsets.end(),
+					[&](const auto& frequent_itemset) { return frequent_itemset.items == itemset; });
 				REQUIRE(iterator != frequent_itemsets.end());
 			}
 
 			THEN("The frequent itemsets contains the itemset {'C'}") {
 				const auto itemset = std::unordered_set<char>{'C'};
-				const auto iterator = std::find(frequent_itemsets.begin(), frequent_itemsets.end(), itemset);
+				const auto iterator = std::find_if(frequent_itemsets.begin(), frequent_itemsets.end(),
+					[&](const auto& frequent_itemset) { return frequent_itemset.items == itemset; });
 				REQUIRE(iterator != frequent_itemsets.end());
 			}
 
 			THEN("The frequent itemsets contains the itemset {'A', 'B'}") {
 				const auto itemset = std::unordered_set<char>{'A', 'B'};
-				const auto iterator = std::find(frequent_itemsets.begin(), frequent_itemsets.end(), itemset);
+				const auto iterator = std::find_if(frequent_itemsets.begin(), frequent_itemsets.end(),
+					[&](const auto& frequent_itemset) { return frequent_itemset.items == itemset; });
 				REQUIRE(iterator != frequent_itemsets.end());
 			}
 
 			THEN("The frequent itemsets contains the itemset {'A', 'C'}") {
 				const auto itemset = std::unordered_set<char>{'A', 'C'};
-				const auto iterator = std::find(frequent_itemsets.begin(), frequent_itemsets.end(), itemset);
+				const auto iterator = std::find_if(frequent_itemsets.begin(), frequent_itemsets.end(),
+					[&](const auto& frequent_itemset) { return frequent_itemset.items == itemset; });
 				REQUIRE(iterator != frequent_itemsets.end());
 			}
 
 			THEN("The frequent itemsets contains the itemset {'B', 'C'}") {
 				const auto itemset = std::unordered_set<char>{'B', 'C'};
-				const auto iterator = std::find(frequent_itemsets.begin(), frequent_itemsets.end(), itemset);
+				const auto iterator = std::find_if(frequent_itemsets.begin(), frequent_itemsets.end(),
+					[&](const auto& frequent_itemset) { return frequent_itemset.items == itemset; });
 				REQUIRE(iterator != frequent_itemsets.end());
 			}
 
 			THEN("The frequent itemsets contains the itemset {'A', 'B', 'C'}") {
 				const auto itemset = std::unordered_set<char>{'A', 'B', 'C'};
-				const auto iterator = std::find(frequent_itemsets.begin(), frequent_itemsets.end(), itemset);
+				const auto iterator = std::find_if(frequent_itemsets.begin(), frequent_itemsets.end(),
+					[&](const auto& frequent_itemset) { return frequent_itemset.items == itemset; });
 				REQUIRE(iterator != frequent_itemsets.end());
 			}
 		}
@@ -129,19 +181,22 @@ SCENARIO("Frequent Itemset Generation", "[frequent_pattern_tree]") {
 
 			THEN("The frequent itemsets contains the itemset {'A'}") {
 				const auto itemset = std::unordered_set<char>{'A'};
-				const auto iterator = std::find(frequent_itemsets.begin(), frequent_itemsets.end(), itemset);
+				const auto iterator = std::find_if(frequent_itemsets.begin(), frequent_itemsets.end(),
+					[&](const auto& frequent_itemset) { return frequent_itemset.items == itemset; });
 				REQUIRE(iterator != frequent_itemsets.end());
 			}
 
 			THEN("The frequent itemsets contains the itemset {'B'}") {
 				const auto itemset = std::unordered_set<char>{'B'};
-				const auto iterator = std::find(frequent_itemsets.begin(), frequent_itemsets.end(), itemset);
+				const auto iterator = std::find_if(frequent_itemsets.begin(), frequent_itemsets.end(),
+					[&](const auto& frequent_itemset) { return frequent_itemset.items == itemset; });
 				REQUIRE(iterator != frequent_itemsets.end());
 			}
 
 			THEN("The frequent itemsets contains the itemset {'C'}") {
 				const auto itemset = std::unordered_set<char>{'C'};
-				const auto iterator = std::find(frequent_itemsets.begin(), frequent_itemsets.end(), itemset);
+				const auto iterator = std::find_if(frequent_itemsets.begin(), frequent_itemsets.end(),
+					[&](const auto& frequent_itemset) { return frequent_itemset.items == itemset; });
 				REQUIRE(iterator != frequent_itemsets.end());
 			}
 		}
@@ -169,67 +224,78 @@ SCENARIO("Frequent Itemset Generation", "[frequent_pattern_tree]") {
 
 			THEN("The frequent itemsets contains the itemset {'A'}") {
 				const auto itemset = std::unordered_set<char>{'A'};
-				const auto iterator = std::find(frequent_itemsets.begin(), frequent_itemsets.end(), itemset);
+				const auto iterator = std::find_if(frequent_itemsets.begin(), frequent_itemsets.end(),
+					[&](const auto& frequent_itemset) { return frequent_itemset.items == itemset; });
 				REQUIRE(iterator != frequent_itemsets.end());
 			}
 
 			THEN("The frequent itemsets contains the itemset {'B'}") {
 				const auto itemset = std::unordered_set<char>{'B'};
-				const auto iterator = std::find(frequent_itemsets.begin(), frequent_itemsets.end(), itemset);
+				const auto iterator = std::find_if(frequent_itemsets.begin(), frequent_itemsets.end(),
+					[&](const auto& frequent_itemset) { return frequent_itemset.items == itemset; });
 				REQUIRE(iterator != frequent_itemsets.end());
 			}
 
 			THEN("The frequent itemsets contains the itemset {'C'}") {
 				const auto itemset = std::unordered_set<char>{'C'};
-				const auto iterator = std::find(frequent_itemsets.begin(), frequent_itemsets.end(), itemset);
+				const auto iterator = std::find_if(frequent_itemsets.begin(), frequent_itemsets.end(),
+					[&](const auto& frequent_itemset) { return frequent_itemset.items == itemset; });
 				REQUIRE(iterator != frequent_itemsets.end());
 			}
 
 			THEN("The frequent itemsets contains the itemset {'A', 'B'}") {
 				const auto itemset = std::unordered_set<char>{'A', 'B'};
-				const auto iterator = std::find(frequent_itemsets.begin(), frequent_itemsets.end(), itemset);
+				const auto iterator = std::find_if(frequent_itemsets.begin(), frequent_itemsets.end(),
+					[&](const auto& frequent_itemset) { return frequent_itemset.items == itemset; });
 				REQUIRE(iterator != frequent_itemsets.end());
 			}
 
 			THEN("The frequent itemsets contains the itemset {'A', 'C'}") {
 				const auto itemset = std::unordered_set<char>{'A', 'C'};
-				const auto iterator = std::find(frequent_itemsets.begin(), frequent_itemsets.end(), itemset);
+				const auto iterator = std::find_if(frequent_itemsets.begin(), frequent_itemsets.end(),
+					[&](const auto& frequent_itemset) { return frequent_itemset.items == itemset; });
 				REQUIRE(iterator != frequent_itemsets.end());
 			}
 
 			THEN("The frequent itemsets contains the itemset {'B', 'C'}") {
 				const auto itemset = std::unordered_set<char>{'B', 'C'};
-				const auto iterator = std::find(frequent_itemsets.begin(), frequent_itemsets.end(), itemset);
+				const auto iterator = std::find_if(frequent_itemsets.begin(), frequent_itemsets.end(),
+					[&](const auto& frequent_itemset) { return frequent_itemset.items == itemset; });
 				REQUIRE(iterator != frequent_itemsets.end());
 			}
 
 			THEN("The frequent itemsets contains the itemset {'A', 'B', 'C'}") {
 				const auto itemset = std::unordered_set<char>{'A', 'B', 'C'};
-				const auto iterator = std::find(frequent_itemsets.begin(), frequent_itemsets.end(), itemset);
+				const auto iterator = std::find_if(frequent_itemsets.begin(), frequent_itemsets.end(),
+					[&](const auto& frequent_itemset) { return frequent_itemset.items == itemset; });
 				REQUIRE(iterator != frequent_itemsets.end());
 			}
 
 			THEN("The frequent itemsets contains the itemset {'D'}") {
 				const auto itemset = std::unordered_set<char>{'E'};
-				const auto iterator = std::find(frequent_itemsets.begin(), frequent_itemsets.end(), itemset);
+				const auto iterator = std::find_if(frequent_itemsets.begin(), frequent_itemsets.end(),
+					[&](const auto& frequent_itemset) { return frequent_itemset.items == itemset; });
 				REQUIRE(iterator != frequent_itemsets.end());
 			}
 
 			THEN("The frequent itemsets contains the itemset {'E'}") {
 				const auto itemset = std::unordered_set<char>{'E'};
-				const auto iterator = std::find(frequent_itemsets.begin(), frequent_itemsets.end(), itemset);
+				const auto iterator = std::find_if(frequent_itemsets.begin(), frequent_itemsets.end(),
+					[&](const auto& frequent_itemset) { return frequent_itemset.items == itemset; });
 				REQUIRE(iterator != frequent_itemsets.end());
 			}
 
 			THEN("The frequent itemsets contains the itemset {'D', 'E'}") {
 				const auto itemset = std::unordered_set<char>{'D', 'E'};
-				const auto iterator = std::find(frequent_itemsets.begin(), frequent_itemsets.end(), itemset);
+				const auto iterator = std::find_if(frequent_itemsets.begin(), frequent_itemsets.end(),
+					[&](const auto& frequent_itemset) { return frequent_itemset.items == itemset; });
 				REQUIRE(iterator != frequent_itemsets.end());
 			}
 
 			THEN("The frequent itemsets contains the itemset {'F'}") {
 				const auto itemset = std::unordered_set<char>{'F'};
-				const auto iterator = std::find(frequent_itemsets.begin(), frequent_itemsets.end(), itemset);
+				const auto iterator = std::find_if(frequent_itemsets.begin(), frequent_itemsets.end(),
+					[&](const auto& frequent_itemset) { return frequent_itemset.items == itemset; });
 				REQUIRE(iterator != frequent_itemsets.end());
 			}
 		}
@@ -262,7 +328,8 @@ SCENARIO("Frequent Itemset Generation", "[frequent_pattern_tree]") {
 
 			THEN("The frequent itemsets contains the itemset {'D'}") {
 				const auto itemset = std::unordered_set<char>{'D'};
-				const auto iterator = std::find(frequent_itemsets.begin(), frequent_itemsets.end(), itemset);
+				const auto iterator = std::find_if(frequent_itemsets.begin(), frequent_itemsets.end(),
+					[&](const auto& frequent_itemset) { return frequent_itemset.items == itemset; });
 				REQUIRE(iterator != frequent_itemsets.end());
 			}
 		}
@@ -276,19 +343,22 @@ SCENARIO("Frequent Itemset Generation", "[frequent_pattern_tree]") {
 
 			THEN("The frequent itemsets contains the itemset {'B'}") {
 				const auto itemset = std::unordered_set<char>{'B'};
-				const auto iterator = std::find(frequent_itemsets.begin(), frequent_itemsets.end(), itemset);
+				const auto iterator = std::find_if(frequent_itemsets.begin(), frequent_itemsets.end(),
+					[&](const auto& frequent_itemset) { return frequent_itemset.items == itemset; });
 				REQUIRE(iterator != frequent_itemsets.end());
 			}
 
 			THEN("The frequent itemsets contains the itemset {'D'}") {
 				const auto itemset = std::unordered_set<char>{'D'};
-				const auto iterator = std::find(frequent_itemsets.begin(), frequent_itemsets.end(), itemset);
+				const auto iterator = std::find_if(frequent_itemsets.begin(), frequent_itemsets.end(),
+					[&](const auto& frequent_itemset) { return frequent_itemset.items == itemset; });
 				REQUIRE(iterator != frequent_itemsets.end());
 			}
 
 			THEN("The frequent itemsets contains the itemset {'B', 'D'}") {
 				const auto itemset = std::unordered_set<char>{'B', 'D'};
-				const auto iterator = std::find(frequent_itemsets.begin(), frequent_itemsets.end(), itemset);
+				const auto iterator = std::find_if(frequent_itemsets.begin(), frequent_itemsets.end(),
+					[&](const auto& frequent_itemset) { return frequent_itemset.items == itemset; });
 				REQUIRE(iterator != frequent_itemsets.end());
 			}
 		}
@@ -302,43 +372,50 @@ SCENARIO("Frequent Itemset Generation", "[frequent_pattern_tree]") {
 
 			THEN("The frequent itemsets contains the itemset {'B'}") {
 				const auto itemset = std::unordered_set<char>{'B'};
-				const auto iterator = std::find(frequent_itemsets.begin(), frequent_itemsets.end(), itemset);
+				const auto iterator = std::find_if(frequent_itemsets.begin(), frequent_itemsets.end(),
+					[&](const auto& frequent_itemset) { return frequent_itemset.items == itemset; });
 				REQUIRE(iterator != frequent_itemsets.end());
 			}
 
 			THEN("The frequent itemsets contains the itemset {'C'}") {
 				const auto itemset = std::unordered_set<char>{'C'};
-				const auto iterator = std::find(frequent_itemsets.begin(), frequent_itemsets.end(), itemset);
+				const auto iterator = std::find_if(frequent_itemsets.begin(), frequent_itemsets.end(),
+					[&](const auto& frequent_itemset) { return frequent_itemset.items == itemset; });
 				REQUIRE(iterator != frequent_itemsets.end());
 			}
 
 			THEN("The frequent itemsets contains the itemset {'D'}") {
 				const auto itemset = std::unordered_set<char>{'D'};
-				const auto iterator = std::find(frequent_itemsets.begin(), frequent_itemsets.end(), itemset);
+				const auto iterator = std::find_if(frequent_itemsets.begin(), frequent_itemsets.end(),
+					[&](const auto& frequent_itemset) { return frequent_itemset.items == itemset; });
 				REQUIRE(iterator != frequent_itemsets.end());
 			}
 
 			THEN("The frequent itemsets contains the itemset {'B', 'C'}") {
 				const auto itemset = std::unordered_set<char>{'B', 'C'};
-				const auto iterator = std::find(frequent_itemsets.begin(), frequent_itemsets.end(), itemset);
+				const auto iterator = std::find_if(frequent_itemsets.begin(), frequent_itemsets.end(),
+					[&](const auto& frequent_itemset) { return frequent_itemset.items == itemset; });
 				REQUIRE(iterator != frequent_itemsets.end());
 			}
 
 			THEN("The frequent itemsets contains the itemset {'B', 'D'}") {
 				const auto itemset = std::unordered_set<char>{'B', 'D'};
-				const auto iterator = std::find(frequent_itemsets.begin(), frequent_itemsets.end(), itemset);
+				const auto iterator = std::find_if(frequent_itemsets.begin(), frequent_itemsets.end(),
+					[&](const auto& frequent_itemset) { return frequent_itemset.items == itemset; });
 				REQUIRE(iterator != frequent_itemsets.end());
 			}
 
 			THEN("The frequent itemsets contains the itemset {'C', 'D'}") {
 				const auto itemset = std::unordered_set<char>{'C', 'D'};
-				const auto iterator = std::find(frequent_itemsets.begin(), frequent_itemsets.end(), itemset);
+				const auto iterator = std::find_if(frequent_itemsets.begin(), frequent_itemsets.end(),
+					[&](const auto& frequent_itemset) { return frequent_itemset.items == itemset; });
 				REQUIRE(iterator != frequent_itemsets.end());
 			}
 
 			THEN("The frequent itemsets contains the itemset {'B', 'C', 'D'}") {
 				const auto itemset = std::unordered_set<char>{'B', 'C', 'D'};
-				const auto iterator = std::find(frequent_itemsets.begin(), frequent_itemsets.end(), itemset);
+				const auto iterator = std::find_if(frequent_itemsets.begin(), frequent_itemsets.end(),
+					[&](const auto& frequent_itemset) { return frequent_itemset.items == itemset; });
 				REQUIRE(iterator != frequent_itemsets.end());
 			}
 		}
@@ -350,83 +427,1177 @@ SCENARIO("Frequent Itemset Generation", "[frequent_pattern_tree]") {
 				REQUIRE(frequent_itemsets.size() == 13);
 			}
 
+			THEN("The support of each frequent itemset is the number of itemsets which contain it") {
+				const auto get_support = [&](const std::unordered_set<char>& itemset) {
+					const auto iterator = std::find_if(frequent_itemsets.begin(), frequent_itemsets.end(),
+						[&](const auto& frequent_itemset) { return frequent_itemset.items == itemset; });
+					return iterator != frequent_itemsets.end() ? iterator->support : 0;
+				};
+				REQUIRE(get_support({'D'}) == 5);
+				REQUIRE(get_support({'B', 'D'}) == 4);
+				REQUIRE(get_support({'B', 'C', 'D'}) == 3);
+				REQUIRE(get_support({'A', 'B', 'D'}) == 2);
+				REQUIRE(get_support({'E', 'D'}) == 2);
+			}
+
 			THEN("The frequent itemsets contains the itemset {'A'}") {
 				const auto itemset = std::unordered_set<char>{'A'};
-				const auto iterator = std::find(frequent_itemsets.begin(), frequent_itemsets.end(), itemset);
+				const auto iterator = std::find_if(frequent_itemsets.begin(), frequent_itemsets.end(),
+					[&](const auto& frequent_itemset) { return frequent_itemset.items == itemset; });
 				REQUIRE(iterator != frequent_itemsets.end());
 			}
 
 			THEN("The frequent itemsets contains the itemset {'A', 'B'}") {
 				const auto itemset = std::unordered_set<char>{'A', 'B'};
-				const auto iterator = std::find(frequent_itemsets.begin(), frequent_itemsets.end(), itemset);
+				const auto iterator = std::find_if(frequent_itemsets.begin(), frequent_itemsets.end(),
+					[&](const auto& frequent_itemset) { return frequent_itemset.items == itemset; });
 				REQUIRE(iterator != frequent_itemsets.end());
 			}
 
 			THEN("The frequent itemsets contains the itemset {'A', 'D'}") {
 				const auto itemset = std::unordered_set<char>{'A', 'D'};
-				const auto iterator = std::find(frequent_itemsets.begin(), frequent_itemsets.end(), itemset);
+				const auto iterator = std::find_if(frequent_itemsets.begin(), frequent_itemsets.end(),
+					[&](const auto& frequent_itemset) { return frequent_itemset.items == itemset; });
 				REQUIRE(iterator != frequent_itemsets.end());
 			}
 
 			THEN("The frequent itemsets contains the itemset {'A', 'B', 'D'}") {
 				const auto itemset = std::unordered_set<char>{'A', 'B', 'D'};
-				const auto iterator = std::find(frequent_itemsets.begin(), frequent_itemsets.end(), itemset);
+				const auto iterator = std::find_if(frequent_itemsets.begin(), frequent_itemsets.end(),
+					[&](const auto& frequent_itemset) { return frequent_itemset.items == itemset; });
 				REQUIRE(iterator != frequent_itemsets.end());
 			}
 
 			THEN("The frequent itemsets contains the itemset {'B'}") {
 				const auto itemset = std::unordered_set<char>{'B'};
-				const auto iterator = std::find(frequent_itemsets.begin(), frequent_itemsets.end(), itemset);
+				const auto iterator = std::find_if(frequent_itemsets.begin(), frequent_itemsets.end(),
+					[&](const auto& frequent_itemset) { return frequent_itemset.items == itemset; });
 				REQUIRE(iterator != frequent_itemsets.end());
 			}
 
 			THEN("The frequent itemsets contains the itemset {'B', 'D'}") {
 				const auto itemset = std::unordered_set<char>{'B', 'D'};
-				const auto iterator = std::find(frequent_itemsets.begin(), frequent_itemsets.end(), itemset);
+				const auto iterator = std::find_if(frequent_itemsets.begin(), frequent_itemsets.end(),
+					[&](const auto& frequent_itemset) { return frequent_itemset.items == itemset; });
 				REQUIRE(iterator != frequent_itemsets.end());
 			}
 
 			THEN("The frequent itemsets contains the itemset {'C'}") {
 				const auto itemset = std::unordered_set<char>{'C'};
-				const auto iterator = std::find(frequent_itemsets.begin(), frequent_itemsets.end(), itemset);
+				const auto iterator = std::find_if(frequent_itemsets.begin(), frequent_itemsets.end(),
+					[&](const auto& frequent_itemset) { return frequent_itemset.items == itemset; });
 				REQUIRE(iterator != frequent_itemsets.end());
 			}
 
 			THEN("The frequent itemsets contains the itemset {'C', 'B'}") {
 				const auto itemset = std::unordered_set<char>{'C', 'B'};
-				const auto iterator = std::find(frequent_itemsets.begin(), frequent_itemsets.end(), itemset);
+				const auto iterator = std::find_if(frequent_itemsets.begin(), frequent_itemsets.end(),
+					[&](const auto& frequent_itemset) { return frequent_itemset.items == itemset; });
 				REQUIRE(iterator != frequent_itemsets.end());
 			}
 
 			THEN("The frequent itemsets contains the itemset {'C', 'D'}") {
 				const auto itemset = std::unordered_set<char>{'C', 'D'};
-				const auto iterator = std::find(frequent_itemsets.begin(), frequent_itemsets.end(), itemset);
+				const auto iterator = std::find_if(frequent_itemsets.begin(), frequent_itemsets.end(),
+					[&](const auto& frequent_itemset) { return frequent_itemset.items == itemset; });
 				REQUIRE(iterator != frequent_itemsets.end());
 			}
 
 			THEN("The frequent itemsets contains the itemset {'C', 'B', 'D'}") {
 				const auto itemset = std::unordered_set<char>{'C', 'B', 'D'};
-				const auto iterator = std::find(frequent_itemsets.begin(), frequent_itemsets.end(), itemset);
+				const auto iterator = std::find_if(frequent_itemsets.begin(), frequent_itemsets.end(),
+					[&](const auto& frequent_itemset) { return frequent_itemset.items == itemset; });
 				REQUIRE(iterator != frequent_itemsets.end());
 			}
 
 			THEN("The frequent itemsets contains the itemset {'D'}") {
 				const auto itemset = std::unordered_set<char>{'D'};
-				const auto iterator = std::find(frequent_itemsets.begin(), frequent_itemsets.end(), itemset);
+				const auto iterator = std::find_if(frequent_itemsets.begin(), frequent_itemsets.end(),
+					[&](const auto& frequent_itemset) { return frequent_itemset.items == itemset; });
 				REQUIRE(iterator != frequent_itemsets.end());
 			}
 
 			THEN("The frequent itemsets contains the itemset {'E'}") {
 				const auto itemset = std::unordered_set<char>{'E'};
-				const auto iterator = std::find(frequent_itemsets.begin(), frequent_itemsets.end(), itemset);
+				const auto iterator = std::find_if(frequent_itemsets.begin(), frequent_itemsets.end(),
+					[&](const auto& frequent_itemset) { return frequent_itemset.items == itemset; });
 				REQUIRE(iterator != frequent_itemsets.end());
 			}
 
 			THEN("The frequent itemsets contains the itemset {'E', 'D'}") {
 				const auto itemset = std::unordered_set<char>{'E', 'D'};
-				const auto iterator = std::find(frequent_itemsets.begin(), frequent_itemsets.end(), itemset);
+				const auto iterator = std::find_if(frequent_itemsets.begin(), frequent_itemsets.end(),
+					[&](const auto& frequent_itemset) { return frequent_itemset.items == itemset; });
+				REQUIRE(iterator != frequent_itemsets.end());
+			}
+		}
+	}
+}
+
+SCENARIO("Frequent Itemset Generation With A Relative Minimum Support", "[frequent_pattern_tree]") {
+
+	GIVEN("A frequent pattern tree constructed from an empty itemset") {
+		const FrequentPatternTree<char> frequent_pattern_tree;
+
+		WHEN("The transaction count is queried") {
+			const auto transaction_count = frequent_pattern_tree.GetTransactionCount();
+
+			THEN("The transaction count is equal to 0") {
+				REQUIRE(transaction_count == 0);
+			}
+		}
+	}
+
+	GIVEN("A frequent pattern tree constructed from multiple itemsets with overlapping elements") {
+		const FrequentPatternTree<char> frequent_pattern_tree{
+			{'B', 'C', 'D'},
+			{'B', 'C', 'D', 'E'},
+			{'D', 'E'},
+			{'A', 'B', 'C', 'D'},
+			{'A', 'B', 'D'}
+		};
+
+		WHEN("The transaction count is queried") {
+			const auto transaction_count = frequent_pattern_tree.GetTransactionCount();
+
+			THEN("The transaction count is equal to the number of itemsets") {
+				REQUIRE(transaction_count == 5);
+			}
+		}
+
+		WHEN("Relative minimum supports are converted to absolute minimum supports") {
+			THEN("Each absolute minimum support is the smallest number of itemsets meeting the relative minimum support") {
+				REQUIRE(frequent_pattern_tree.GetMinimumSupport(0.0) == 1);
+				REQUIRE(frequent_pattern_tree.GetMinimumSupport(0.2) == 1);
+				REQUIRE(frequent_pattern_tree.GetMinimumSupport(0.3) == 2);
+				REQUIRE(frequent_pattern_tree.GetMinimumSupport(0.6) == 3);
+				REQUIRE(frequent_pattern_tree.GetMinimumSupport(1.0) == 5);
+			}
+		}
+
+		WHEN("A relative minimum support which is not a number is converted") {
+			THEN("The conversion is rejected") {
+				REQUIRE_THROWS_AS(
+					frequent_pattern_tree.GetMinimumSupport(std::numeric_limits<double>::quiet_NaN()), std::invalid_argument);
+			}
+		}
+
+		WHEN("A fractional minimum support is passed directly to a query") {
+			THEN("The query does not compile rather than truncating the minimum support to 0") {
+				REQUIRE(IsMinimumSupport<uint32_t>::value);
+				REQUIRE(IsMinimumSupport<int>::value);
+				REQUIRE(!IsMinimumSupport<double>::value);
+				REQUIRE(!IsMinimumSupport<float>::value);
+			}
+		}
+
+		WHEN("Frequent itemsets are extracted with a relative minimum support of 0.8") {
+			const auto frequent_itemsets = frequent_pattern_tree.GetFrequentItemsets(frequent_pattern_tree.GetMinimumSupport(0.8));
+
+			THEN("The frequent itemsets occur in at least 80% of itemsets") {
+				REQUIRE(frequent_itemsets.size() == 3);
+			}
+		}
+	}
+
+	GIVEN("A frequent pattern tree constructed in parallel from 100 itemsets") {
+		std::vector<std::unordered_set<int>> itemsets(100, std::unordered_set<int>{1});
+		ThreadPool thread_pool{4};
+		const FrequentPatternTree<int> frequent_pattern_tree{itemsets.cbegin(), itemsets.cend(), thread_pool};
+
+		WHEN("A relative minimum support which is not exactly representable is converted") {
+			const auto minimum_support = frequent_pattern_tree.GetMinimumSupport(0.07);
+
+			THEN("The absolute minimum support is not rounded up") {
+				REQUIRE(frequent_pattern_tree.GetTransactionCount() == 100);
+				REQUIRE(minimum_support == 7);
+			}
+		}
+	}
+}
+
+SCENARIO("Frequent Itemset Generation With A Build Minimum Support", "[frequent_pattern_tree]") {
+
+	GIVEN("A frequent pattern tree constructed with a minimum support of 3 from itemsets with overlapping elements") {
+		const std::vector<std::unordered_set<char>> itemsets{
+			{'B', 'C', 'D'},
+			{'B', 'C', 'D', 'E'},
+			{'D', 'E'},
+			{'A', 'B', 'C', 'D'},
+			{'A', 'B', 'D'}
+		};
+		const FrequentPatternTree<char> frequent_pattern_tree{itemsets.cbegin(), itemsets.cend(), 3};
+
+		WHEN("Frequent itemsets are extracted with a minimum support of 3") {
+			const auto frequent_itemsets = frequent_pattern_tree.GetFrequentItemsets(3);
+
+			THEN("The frequent itemsets are the same as those of a tree constructed without a minimum support") {
+				const FrequentPatternTree<char> unpruned_frequent_pattern_tree{itemsets.cbegin(), itemsets.cend()};
+				const auto unpruned_frequent_itemsets = unpruned_frequent_pattern_tree.GetFrequentItemsets(3);
+				REQUIRE(IsEquivalent(frequent_itemsets, unpruned_frequent_itemsets));
+			}
+		}
+
+		WHEN("Frequent itemsets are extracted with a minimum support of 1") {
+			const auto frequent_itemsets = frequent_pattern_tree.GetFrequentItemsets(1);
+
+			THEN("The frequent itemsets does not contain the infrequent itemset {'A'}") {
+				const auto itemset = std::unordered_set<char>{'A'};
+				const auto iterator = std::find_if(frequent_itemsets.begin(), frequent_itemsets.end(),
+					[&](const auto& frequent_itemset) { return frequent_itemset.items == itemset; });
+				REQUIRE(iterator == frequent_itemsets.end());
+			}
+
+			THEN("The frequent itemsets does not contain the infrequent itemset {'D', 'E'}") {
+				const auto itemset = std::unordered_set<char>{'D', 'E'};
+				const auto iterator = std::find_if(frequent_itemsets.begin(), frequent_itemsets.end(),
+					[&](const auto& frequent_itemset) { return frequent_itemset.items == itemset; });
+				REQUIRE(iterator == frequent_itemsets.end());
+			}
+		}
+	}
+}
+
+SCENARIO("Frequent Itemset Generation Over Single Prefix Paths", "[frequent_pattern_tree]") {
+
+	GIVEN("A frequent pattern tree whose itemsets share a single prefix path before branching") {
+		const FrequentPatternTree<char> frequent_pattern_tree{
+			{'A', 'B', 'C', 'D'},
+			{'A', 'B', 'C', 'E'},
+			{'A', 'B', 'C'}
+		};
+
+		WHEN("Frequent itemsets are extracted with a minimum support of 2") {
+			const auto frequent_itemsets = frequent_pattern_tree.GetFrequentItemsets(2);
+
+			THEN("The number of frequent itemsets is equal to the number of combinations of the prefix path") {
+				REQUIRE(frequent_itemsets.size() == 7);
+			}
+
+			THEN("The frequent itemsets contains the itemset {'A', 'B', 'C'}") {
+				const auto itemset = std::unordered_set<char>{'A', 'B', 'C'};
+				const auto iterator = std::find_if(frequent_itemsets.begin(), frequent_itemsets.end(),
+					[&](const auto& frequent_itemset) { return frequent_itemset.items == itemset; });
+				REQUIRE(iterator != frequent_itemsets.end());
+			}
+
+			THEN("The support of the itemset {'A', 'C'} is the support of its deepest node on the prefix path") {
+				const auto itemset = std::unordered_set<char>{'A', 'C'};
+				const auto iterator = std::find_if(frequent_itemsets.begin(), frequent_itemsets.end(),
+					[&](const auto& frequent_itemset) { return frequent_itemset.items == itemset; });
+				REQUIRE(iterator != frequent_itemsets.end());
+				REQUIRE(iterator->support == 3);
+			}
+		}
+
+		WHEN("Frequent itemsets are extracted with a minimum support of 1") {
+			const auto frequent_itemsets = frequent_pattern_tree.GetFrequentItemsets(1);
+
+			THEN("The number of frequent itemsets is equal to the number of unique combinations in each itemset") {
+				REQUIRE(frequent_itemsets.size() == 23);
+			}
+
+			THEN("The frequent itemsets contains the itemset {'A', 'C', 'E'}") {
+				const auto itemset = std::unordered_set<char>{'A', 'C', 'E'};
+				const auto iterator = std::find_if(frequent_itemsets.begin(), frequent_itemsets.end(),
+					[&](const auto& frequent_itemset) { return frequent_itemset.items == itemset; });
 				REQUIRE(iterator != frequent_itemsets.end());
 			}
+
+			THEN("The frequent itemsets does not contain the itemset {'D', 'E'}") {
+				const auto itemset = std::unordered_set<char>{'D', 'E'};
+				const auto iterator = std::find_if(frequent_itemsets.begin(), frequent_itemsets.end(),
+					[&](const auto& frequent_itemset) { return frequent_itemset.items == itemset; });
+				REQUIRE(iterator == frequent_itemsets.end());
+			}
+		}
+	}
+}
+
+SCENARIO("Streaming Frequent Itemset Generation", "[frequent_pattern_tree]") {
+
+	GIVEN("A frequent pattern tree constructed from multiple itemsets with overlapping elements") {
+		const FrequentPatternTree<char> frequent_pattern_tree{
+			{'B', 'C', 'D'},
+			{'B', 'C', 'D', 'E'},
+			{'D', 'E'},
+			{'A', 'B', 'C', 'D'},
+			{'A', 'B', 'D'}
+		};
+
+		WHEN("Frequent itemsets are streamed to a sink with a minimum support of 2") {
+			std::vector<FrequentPatternTree<char>::FrequentItemset> frequent_itemsets;
+			frequent_pattern_tree.GetFrequentItemsets(2, [&](auto&& frequent_itemset) {
+				frequent_itemsets.push_back(std::forward<decltype(frequent_itemset)>(frequent_itemset));
+			});
+
+			THEN("The sink receives the same frequent itemsets which are returned by value") {
+				const auto expected_frequent_itemsets = frequent_pattern_tree.GetFrequentItemsets(2);
+				REQUIRE(IsEquivalent(frequent_itemsets, expected_frequent_itemsets));
+			}
+		}
+	}
+}
+
+SCENARIO("Lazy Frequent Itemset Generation", "[frequent_pattern_tree]") {
+
+	GIVEN("A frequent pattern tree constructed from an empty itemset") {
+		const FrequentPatternTree<char> frequent_pattern_tree;
+
+		WHEN("A lazy range of frequent itemsets is created with a minimum support of 1") {
+			auto frequent_itemset_range = frequent_pattern_tree.GetFrequentItemsetRange(1);
+
+			THEN("The range is empty") {
+				REQUIRE(frequent_itemset_range.begin() == frequent_itemset_range.end());
+			}
+		}
+	}
+
+	GIVEN("A frequent pattern tree constructed from multiple itemsets with overlapping elements") {
+		const FrequentPatternTree<char> frequent_pattern_tree{
+			{'B', 'C', 'D'},
+			{'B', 'C', 'D', 'E'},
+			{'D', 'E'},
+			{'A', 'B', 'C', 'D'},
+			{'A', 'B', 'D'}
+		};
+
+		WHEN("A lazy range of frequent itemsets is fully iterated with a minimum support of 2") {
+			std::vector<FrequentPatternTree<char>::FrequentItemset> frequent_itemsets;
+			for (const auto& frequent_itemset : frequent_pattern_tree.GetFrequentItemsetRange(2)) {
+				frequent_itemsets.push_back(frequent_itemset);
+			}
+
+			THEN("The range contains the same frequent itemsets which are returned by value") {
+				const auto expected_frequent_itemsets = frequent_pattern_tree.GetFrequentItemsets(2);
+				REQUIRE(IsEquivalent(frequent_itemsets, expected_frequent_itemsets));
+			}
+		}
+
+		WHEN("A lazy range of frequent itemsets is iterated by post-increment with a minimum support of 2") {
+			std::vector<FrequentPatternTree<char>::FrequentItemset> frequent_itemsets;
+			auto frequent_itemset_range = frequent_pattern_tree.GetFrequentItemsetRange(2);
+			for (auto iterator = frequent_itemset_range.begin(); iterator != frequent_itemset_range.end();) {
+				frequent_itemsets.push_back(*iterator++);
+			}
+
+			THEN("Each dereferenced post-increment yields the frequent itemset before the increment") {
+				const auto expected_frequent_itemsets = frequent_pattern_tree.GetFrequentItemsets(2);
+				REQUIRE(IsEquivalent(frequent_itemsets, expected_frequent_itemsets));
+			}
+		}
+
+		WHEN("Only the first three frequent itemsets are taken from a lazy range with a minimum support of 2") {
+			std::vector<FrequentPatternTree<char>::FrequentItemset> frequent_itemsets;
+			auto frequent_itemset_range = frequent_pattern_tree.GetFrequentItemsetRange(2);
+			for (auto iterator = frequent_itemset_range.begin(); frequent_itemsets.size() < 3; ++iterator) {
+				frequent_itemsets.push_back(*iterator);
+			}
+
+			THEN("Each frequent itemset taken is one of the frequent itemsets which are returned by value") {
+				const auto expected_frequent_itemsets = frequent_pattern_tree.GetFrequentItemsets(2);
+				for (const auto& frequent_itemset : frequent_itemsets) {
+					const auto iterator = std::find_if(expected_frequent_itemsets.begin(), expected_frequent_itemsets.end(),
+						[&](const auto& expected_frequent_itemset) {
+							return expected_frequent_itemset.items == frequent_itemset.items
+								&& expected_frequent_itemset.support == frequent_itemset.support;
+						});
+					REQUIRE(iterator != expected_frequent_itemsets.end());
+				}
+			}
+		}
+	}
+}
+
+SCENARIO("Frequent Itemset Generation With Length Constraints", "[frequent_pattern_tree]") {
+
+	GIVEN("A frequent pattern tree constructed from multiple itemsets with overlapping elements") {
+		const FrequentPatternTree<char> frequent_pattern_tree{
+			{'B', 'C', 'D'},
+			{'B', 'C', 'D', 'E'},
+			{'D', 'E'},
+			{'A', 'B', 'C', 'D'},
+			{'A', 'B', 'D'}
+		};
+
+		FrequentPatternTree<char>::ItemsetConstraints constraints;
+
+		WHEN("Frequent itemsets are extracted with a minimum support of 2 and a maximum length of 1") {
+			constraints.max_length = 1;
+			const auto frequent_itemsets = frequent_pattern_tree.GetFrequentItemsets(2, constraints);
+
+			THEN("Only frequent items are extracted") {
+				REQUIRE(frequent_itemsets.size() == 5);
+				for (const auto& [items, support] : frequent_itemsets) REQUIRE(items.size() == 1);
+			}
+		}
+
+		WHEN("Frequent itemsets are extracted with a minimum support of 2 and a minimum and maximum length of 2") {
+			constraints.min_length = 2;
+			constraints.max_length = 2;
+			const auto frequent_itemsets = frequent_pattern_tree.GetFrequentItemsets(2, constraints);
+
+			THEN("Only frequent pairs are extracted") {
+				REQUIRE(frequent_itemsets.size() == 6);
+				for (const auto& [items, support] : frequent_itemsets) REQUIRE(items.size() == 2);
+			}
+		}
+
+		WHEN("Frequent itemsets are extracted lazily with a minimum support of 2 and a minimum length of 3") {
+			constraints.min_length = 3;
+			std::vector<FrequentPatternTree<char>::FrequentItemset> frequent_itemsets;
+			for (const auto& frequent_itemset : frequent_pattern_tree.GetFrequentItemsetRange(2, constraints)) {
+				frequent_itemsets.push_back(frequent_itemset);
+			}
+
+			THEN("Only frequent itemsets of at least 3 items are extracted") {
+				REQUIRE(frequent_itemsets.size() == 2);
+				for (const auto& [items, support] : frequent_itemsets) REQUIRE(items.size() == 3);
+			}
+		}
+	}
+}
+
+SCENARIO("Frequent Itemset Generation With Item Constraints", "[frequent_pattern_tree]") {
+
+	GIVEN("A frequent pattern tree constructed from multiple itemsets with overlapping elements") {
+		const FrequentPatternTree<char> frequent_pattern_tree{
+			{'B', 'C', 'D'},
+			{'B', 'C', 'D', 'E'},
+			{'D', 'E'},
+			{'A', 'B', 'C', 'D'},
+			{'A', 'B', 'D'}
+		};
+
+		FrequentPatternTree<char>::ItemsetConstraints constraints;
+
+		WHEN("Frequent itemsets are extracted with a minimum support of 2 and a required item") {
+			constraints.required_items = {'C'};
+			const auto frequent_itemsets = frequent_pattern_tree.GetFrequentItemsets(2, constraints);
+
+			THEN("Only frequent itemsets containing the required item are extracted") {
+				REQUIRE(frequent_itemsets.size() == 4);
+				for (const auto& [items, support] : frequent_itemsets) REQUIRE(items.count('C'));
+			}
+		}
+
+		WHEN("Frequent itemsets are extracted with a minimum support of 2 and a forbidden item") {
+			constraints.forbidden_items = {'B'};
+			const auto frequent_itemsets = frequent_pattern_tree.GetFrequentItemsets(2, constraints);
+
+			THEN("No frequent itemset contains the forbidden item") {
+				REQUIRE(frequent_itemsets.size() == 7);
+				for (const auto& [items, support] : frequent_itemsets) REQUIRE(!items.count('B'));
+			}
+		}
+
+		WHEN("Frequent itemsets are extracted with a minimum support of 2 and a required item which does not exist") {
+			constraints.required_items = {'F'};
+			const auto frequent_itemsets = frequent_pattern_tree.GetFrequentItemsets(2, constraints);
+
+			THEN("No frequent itemsets are extracted") {
+				REQUIRE(frequent_itemsets.empty());
+			}
+		}
+
+		WHEN("Frequent itemsets are extracted with a minimum support of 1 and an anti-monotone predicate") {
+			constraints.predicate = [](const auto& frequent_itemset) { return frequent_itemset.items.size() <= 2; };
+			const auto frequent_itemsets = frequent_pattern_tree.GetFrequentItemsets(1, constraints);
+
+			THEN("Only frequent itemsets accepted by the predicate are extracted") {
+				REQUIRE(frequent_itemsets.size() == 14);
+				for (const auto& [items, support] : frequent_itemsets) REQUIRE(items.size() <= 2);
+			}
+		}
+	}
+}
+
+SCENARIO("Frequent Itemset Generation With Item Minimum Supports", "[frequent_pattern_tree]") {
+
+	GIVEN("Multiple itemsets with overlapping elements and a minimum support for each item") {
+		const std::vector<std::unordered_set<char>> itemsets{
+			{'B', 'C', 'D'},
+			{'B', 'C', 'D', 'E'},
+			{'D', 'E'},
+			{'A', 'B', 'C', 'D'},
+			{'A', 'B', 'D'}
+		};
+		const std::unordered_map<char, uint32_t> item_minimum_supports{{'D', 6}, {'A', 1}};
+
+		WHEN("Frequent itemsets are extracted from a tree built with the same item minimum supports") {
+			const FrequentPatternTree<char> frequent_pattern_tree{
+				itemsets.cbegin(), itemsets.cend(), item_minimum_supports, 3};
+			const auto frequent_itemsets = frequent_pattern_tree.GetFrequentItemsets(item_minimum_supports, 3);
+
+			THEN("Each itemset is frequent under the lowest minimum support of its items") {
+				REQUIRE(frequent_itemsets.size() == 14);
+			}
+
+			THEN("A common item with a high minimum support is only frequent alongside other items") {
+				const auto is_itemset = [](const std::unordered_set<char>& itemset) {
+					return [=](const auto& frequent_itemset) { return frequent_itemset.items == itemset; };
+				};
+				REQUIRE(std::none_of(frequent_itemsets.cbegin(), frequent_itemsets.cend(), is_itemset({'D'})));
+				REQUIRE(std::any_of(frequent_itemsets.cbegin(), frequent_itemsets.cend(), is_itemset({'B', 'D'})));
+			}
+
+			THEN("A rare item with a low minimum support is frequent in every itemset it occurs in") {
+				const auto iterator = std::find_if(frequent_itemsets.cbegin(), frequent_itemsets.cend(),
+					[](const auto& frequent_itemset) { return frequent_itemset.items == std::unordered_set<char>{'A', 'B', 'C', 'D'}; });
+				REQUIRE(iterator != frequent_itemsets.cend());
+				REQUIRE(iterator->support == 1);
+			}
+		}
+
+		WHEN("Frequent itemsets are extracted from a tree built without item minimum supports") {
+			const FrequentPatternTree<char> frequent_pattern_tree{itemsets.cbegin(), itemsets.cend()};
+			const auto frequent_itemsets = frequent_pattern_tree.GetFrequentItemsets(item_minimum_supports, 3);
+
+			THEN("The same frequent itemsets are extracted") {
+				REQUIRE(frequent_itemsets.size() == 14);
+			}
+		}
+	}
+}
+
+SCENARIO("Closed Itemset Generation", "[frequent_pattern_tree]") {
+
+	GIVEN("A frequent pattern tree constructed from an empty itemset") {
+		const FrequentPatternTree<char> frequent_pattern_tree;
+
+		WHEN("Closed itemsets are extracted with a minimum support of 1") {
+			const auto closed_itemsets = frequent_pattern_tree.GetClosedItemsets(1);
+
+			THEN("No closed itemsets exist") {
+				REQUIRE(closed_itemsets.empty());
+			}
+		}
+	}
+
+	GIVEN("A frequent pattern tree constructed from multiple itemsets with overlapping elements") {
+		const FrequentPatternTree<char> frequent_pattern_tree{
+			{'B', 'C', 'D'},
+			{'B', 'C', 'D', 'E'},
+			{'D', 'E'},
+			{'A', 'B', 'C', 'D'},
+			{'A', 'B', 'D'}
+		};
+
+		WHEN("Closed itemsets are extracted with a minimum support of 2") {
+			const auto closed_itemsets = frequent_pattern_tree.GetClosedItemsets(2);
+
+			THEN("The size of the closed itemsets is equal to 5") {
+				REQUIRE(closed_itemsets.size() == 5);
+			}
+
+			THEN("Each frequent itemset without a superset of equal support is closed") {
+				const std::vector<std::pair<std::unordered_set<char>, uint32_t>> expected_closed_itemsets{
+					{{'D'}, 5},
+					{{'B', 'D'}, 4},
+					{{'B', 'C', 'D'}, 3},
+					{{'A', 'B', 'D'}, 2},
+					{{'D', 'E'}, 2}
+				};
+
+				for (const auto& [itemset, support] : expected_closed_itemsets) {
+					const auto iterator = std::find_if(closed_itemsets.begin(), closed_itemsets.end(),
+						[&](const auto& closed_itemset) { return closed_itemset.items == itemset; });
+					REQUIRE(iterator != closed_itemsets.end());
+					REQUIRE(iterator->support == support);
+				}
+			}
+		}
+
+		WHEN("Closed itemsets are streamed to a sink with a minimum support of 1") {
+			std::vector<FrequentPatternTree<char>::FrequentItemset> closed_itemsets;
+			frequent_pattern_tree.GetClosedItemsets(1, [&](auto&& closed_itemset) {
+				closed_itemsets.push_back(std::forward<decltype(closed_itemset)>(closed_itemset));
+			});
+
+			THEN("The closed itemsets include those which only occur once") {
+				REQUIRE(closed_itemsets.size() == 7);
+			}
+		}
+
+		WHEN("Closed itemsets are extracted with a minimum support of 0") {
+			const auto closed_itemsets = frequent_pattern_tree.GetClosedItemsets(0);
+
+			THEN("The closed itemsets are the same as those with a minimum support of 1") {
+				REQUIRE(closed_itemsets.size() == 7);
+			}
+		}
+	}
+}
+
+SCENARIO("Maximal Itemset Generation", "[frequent_pattern_tree]") {
+
+	GIVEN("A frequent pattern tree constructed from an empty itemset") {
+		const FrequentPatternTree<char> frequent_pattern_tree;
+
+		WHEN("Maximal itemsets are extracted with a minimum support of 1") {
+			const auto maximal_itemsets = frequent_pattern_tree.GetMaximalItemsets(1);
+
+			THEN("No maximal itemsets exist") {
+				REQUIRE(maximal_itemsets.empty());
+			}
+		}
+	}
+
+	GIVEN("A frequent pattern tree constructed from multiple itemsets with overlapping elements") {
+		const FrequentPatternTree<char> frequent_pattern_tree{
+			{'B', 'C', 'D'},
+			{'B', 'C', 'D', 'E'},
+			{'D', 'E'},
+			{'A', 'B', 'C', 'D'},
+			{'A', 'B', 'D'}
+		};
+
+		WHEN("Maximal itemsets are extracted with a minimum support of 2") {
+			const auto maximal_itemsets = frequent_pattern_tree.GetMaximalItemsets(2);
+
+			THEN("The size of the maximal itemsets is equal to 3") {
+				REQUIRE(maximal_itemsets.size() == 3);
+			}
+
+			THEN("Each frequent itemset without a frequent superset is maximal") {
+				const std::vector<std::pair<std::unordered_set<char>, uint32_t>> expected_maximal_itemsets{
+					{{'B', 'C', 'D'}, 3},
+					{{'A', 'B', 'D'}, 2},
+					{{'D', 'E'}, 2}
+				};
+
+				for (const auto& [itemset, support] : expected_maximal_itemsets) {
+					const auto iterator = std::find_if(maximal_itemsets.begin(), maximal_itemsets.end(),
+						[&](const auto& maximal_itemset) { return maximal_itemset.items == itemset; });
+					REQUIRE(iterator != maximal_itemsets.end());
+					REQUIRE(iterator->support == support);
+				}
+			}
+		}
+
+		WHEN("Maximal itemsets are extracted with a minimum support of 1") {
+			const auto maximal_itemsets = frequent_pattern_tree.GetMaximalItemsets(1);
+
+			THEN("Only the itemsets which are not contained in another itemset are maximal") {
+				REQUIRE(maximal_itemsets.size() == 2);
+			}
+		}
+
+	}
+
+	GIVEN("A frequent pattern tree where some items never occur together") {
+		const FrequentPatternTree<char> frequent_pattern_tree{
+			{'A', 'C', 'D'},
+			{'D'},
+			{'A', 'B', 'D'},
+			{'A', 'B', 'C'}
+		};
+
+		WHEN("Maximal itemsets are extracted with a minimum support of 0") {
+			const auto maximal_itemsets = frequent_pattern_tree.GetMaximalItemsets(0);
+
+			THEN("The maximal itemsets are the same as those with a minimum support of 1") {
+				REQUIRE(maximal_itemsets.size() == 3);
+				REQUIRE(frequent_pattern_tree.GetMaximalItemsets(1).size() == 3);
+			}
+		}
+	}
+
+	GIVEN("A frequent pattern tree consisting of a single path") {
+		const FrequentPatternTree<char> frequent_pattern_tree{
+			{'A', 'B', 'C'},
+			{'A', 'B'},
+			{'A'}
+		};
+
+		WHEN("Maximal itemsets are extracted with a minimum support of 2") {
+			const auto maximal_itemsets = frequent_pattern_tree.GetMaximalItemsets(2);
+
+			THEN("The frequent part of the path is the only maximal itemset") {
+				REQUIRE(maximal_itemsets.size() == 1);
+				REQUIRE(maximal_itemsets.front().items == std::unordered_set<char>{'A', 'B'});
+				REQUIRE(maximal_itemsets.front().support == 2);
+			}
+		}
+	}
+}
+
+SCENARIO("Top-K Itemset Generation", "[frequent_pattern_tree]") {
+
+	GIVEN("A frequent pattern tree constructed from multiple itemsets with overlapping elements") {
+		const FrequentPatternTree<char> frequent_pattern_tree{
+			{'B', 'C', 'D'},
+			{'B', 'C', 'D', 'E'},
+			{'D', 'E'},
+			{'A', 'B', 'C', 'D'},
+			{'A', 'B', 'D'}
+		};
+
+		WHEN("The top 3 itemsets are extracted") {
+			const auto top_k_itemsets = frequent_pattern_tree.GetTopKItemsets(3);
+
+			THEN("The itemsets with the highest support are returned in order of descending support") {
+				REQUIRE(top_k_itemsets.size() == 3);
+				REQUIRE(top_k_itemsets[0].items == std::unordered_set<char>{'D'});
+				REQUIRE(top_k_itemsets[0].support == 5);
+				REQUIRE(top_k_itemsets[1].support == 4);
+				REQUIRE(top_k_itemsets[2].support == 4);
+			}
+		}
+
+		WHEN("The top 2 itemsets with at least 2 items are extracted") {
+			const auto top_k_itemsets = frequent_pattern_tree.GetTopKItemsets(2, 2);
+
+			THEN("Only itemsets with at least 2 items are returned") {
+				REQUIRE(top_k_itemsets.size() == 2);
+				REQUIRE(top_k_itemsets[0].items == std::unordered_set<char>{'B', 'D'});
+				REQUIRE(top_k_itemsets[0].support == 4);
+				REQUIRE(top_k_itemsets[1].items.size() >= 2);
+				REQUIRE(top_k_itemsets[1].support == 3);
+			}
+		}
+
+		WHEN("More itemsets are requested than exist") {
+			const auto top_k_itemsets = frequent_pattern_tree.GetTopKItemsets(1000);
+
+			THEN("Every itemset which occurs at least once is returned") {
+				REQUIRE(top_k_itemsets.size() == frequent_pattern_tree.GetFrequentItemsets(1).size());
+			}
+		}
+
+		WHEN("No itemsets are requested") {
+			const auto top_k_itemsets = frequent_pattern_tree.GetTopKItemsets(0);
+
+			THEN("No itemsets are returned") {
+				REQUIRE(top_k_itemsets.empty());
+			}
+		}
+	}
+}
+
+SCENARIO("Incremental Frequent Pattern Tree Updates", "[frequent_pattern_tree]") {
+
+	GIVEN("A frequent pattern tree constructed from some itemsets with overlapping elements") {
+		const std::vector<std::unordered_set<char>> itemsets{
+			{'B', 'C', 'D'},
+			{'B', 'C', 'D', 'E'},
+			{'D', 'E'},
+			{'A', 'B', 'C', 'D'},
+			{'A', 'B', 'D'},
+			{'A', 'F'},
+			{'A', 'E', 'F'},
+			{'A', 'F'}
+		};
+
+		FrequentPatternTree<char> frequent_pattern_tree{itemsets.cbegin(), std::next(itemsets.cbegin(), 5)};
+		const FrequentPatternTree<char> expected_frequent_pattern_tree{itemsets.cbegin(), itemsets.cend()};
+
+		WHEN("A batch of itemsets containing a new item is inserted") {
+			frequent_pattern_tree.Insert(std::next(itemsets.cbegin(), 5), itemsets.cend());
+
+			THEN("The transaction count includes the inserted itemsets") {
+				REQUIRE(frequent_pattern_tree.GetTransactionCount() == 8);
+			}
+
+			THEN("The frequent itemsets are the same as those of a tree constructed from every itemset") {
+				REQUIRE(IsEquivalent(
+					frequent_pattern_tree.GetFrequentItemsets(2), expected_frequent_pattern_tree.GetFrequentItemsets(2)));
+			}
+		}
+
+		WHEN("A batch of itemsets is inserted and the tree is restructured") {
+			frequent_pattern_tree.Insert(std::next(itemsets.cbegin(), 5), itemsets.cend());
+			frequent_pattern_tree.Restructure();
+
+			THEN("The frequent itemsets are unchanged by restructuring") {
+				REQUIRE(IsEquivalent(
+					frequent_pattern_tree.GetFrequentItemsets(1), expected_frequent_pattern_tree.GetFrequentItemsets(1)));
+				REQUIRE(IsEquivalent(
+					frequent_pattern_tree.GetClosedItemsets(2), expected_frequent_pattern_tree.GetClosedItemsets(2)));
+			}
+		}
+
+		WHEN("A batch of itemsets is inserted and the original itemsets are removed") {
+			frequent_pattern_tree.Insert(std::next(itemsets.cbegin(), 5), itemsets.cend());
+			frequent_pattern_tree.Remove(itemsets.cbegin(), std::next(itemsets.cbegin(), 5));
+			const FrequentPatternTree<char> expected_remaining_tree{std::next(itemsets.cbegin(), 5), itemsets.cend()};
+
+			THEN("The transaction count excludes the removed itemsets") {
+				REQUIRE(frequent_pattern_tree.GetTransactionCount() == 3);
+			}
+
+			THEN("The frequent itemsets are the same as those of a tree constructed from the remaining itemsets") {
+				REQUIRE(IsEquivalent(
+					frequent_pattern_tree.GetFrequentItemsets(1), expected_remaining_tree.GetFrequentItemsets(1)));
+			}
+		}
+
+		WHEN("Some itemsets are removed and inserted again") {
+			frequent_pattern_tree.Remove(std::next(itemsets.cbegin(), 2), std::next(itemsets.cbegin(), 5));
+			frequent_pattern_tree.Insert(std::next(itemsets.cbegin(), 2), itemsets.cend());
+
+			THEN("The frequent itemsets are the same as those of a tree constructed from every itemset") {
+				REQUIRE(IsEquivalent(
+					frequent_pattern_tree.GetFrequentItemsets(1), expected_frequent_pattern_tree.GetFrequentItemsets(1)));
+				REQUIRE(IsEquivalent(
+					frequent_pattern_tree.GetMaximalItemsets(2), expected_frequent_pattern_tree.GetMaximalItemsets(2)));
+			}
+		}
+	}
+
+	GIVEN("Itemsets in which one item occurs fewer times than a construction minimum support") {
+		const std::vector<std::unordered_set<char>> itemsets{{'A', 'X'}, {'A', 'X'}, {'A'}};
+		const std::vector<std::unordered_set<char>> new_itemsets{{'A', 'X'}};
+
+		WHEN("Itemsets are inserted into a tree which omitted that item at construction") {
+			FrequentPatternTree<char> frequent_pattern_tree{itemsets.cbegin(), itemsets.cend(), 3};
+
+			THEN("The insertion is rejected and the tree is unchanged") {
+				REQUIRE_THROWS_AS(frequent_pattern_tree.Insert(new_itemsets.cbegin(), new_itemsets.cend()), std::logic_error);
+				REQUIRE(frequent_pattern_tree.GetTransactionCount() == 3);
+				REQUIRE(frequent_pattern_tree.GetFrequentItemsets(3).size() == 1);
+			}
+		}
+
+		WHEN("Itemsets are inserted into a tree which omitted that item under a minimum support per item") {
+			const std::unordered_map<char, uint32_t> item_minimum_supports{{'X', 3}};
+			FrequentPatternTree<char> frequent_pattern_tree{itemsets.cbegin(), itemsets.cend(), item_minimum_supports, 3};
+
+			THEN("The insertion is rejected") {
+				REQUIRE_THROWS_AS(frequent_pattern_tree.Insert(new_itemsets.cbegin(), new_itemsets.cend()), std::logic_error);
+			}
+		}
+
+		WHEN("Itemsets are inserted into a tree whose construction minimum support omitted no item") {
+			FrequentPatternTree<char> frequent_pattern_tree{itemsets.cbegin(), itemsets.cend(), 2};
+			frequent_pattern_tree.Insert(new_itemsets.cbegin(), new_itemsets.cend());
+
+			THEN("Every occurrence of the item is counted") {
+				const FrequentPatternTree<char> expected_frequent_pattern_tree{{'A', 'X'}, {'A', 'X'}, {'A'}, {'A', 'X'}};
+				REQUIRE(IsEquivalent(
+					frequent_pattern_tree.GetFrequentItemsets(3), expected_frequent_pattern_tree.GetFrequentItemsets(3)));
+				REQUIRE(frequent_pattern_tree.GetFrequentItemsets(3).size() == 3);
+			}
+		}
+	}
+}
+
+SCENARIO("Frequent Itemset Generation Over Sparse Itemsets", "[frequent_pattern_tree]") {
+
+	GIVEN("A frequent pattern tree constructed from every combination of three out of eight items") {
+		std::vector<std::unordered_set<int>> itemsets;
+
+		for (auto a = 0; a < 8; ++a) {
+			for (auto b = a + 1; b < 8; ++b) {
+				for (auto c = b + 1; c < 8; ++c) {
+					itemsets.push_back({a, b, c});
+				}
+			}
+		}
+
+		const FrequentPatternTree<int> frequent_pattern_tree{itemsets.cbegin(), itemsets.cend()};
+
+		WHEN("Frequent itemsets are extracted with a minimum support of 1") {
+			const auto frequent_itemsets = frequent_pattern_tree.GetFrequentItemsets(1);
+
+			THEN("Every item, pair, and triple is frequent") {
+				REQUIRE(frequent_itemsets.size() == 8 + 28 + 56);
+			}
+
+			THEN("The support of each frequent itemset is the number of combinations containing it") {
+				for (const auto& [items, support] : frequent_itemsets) {
+					switch (items.size()) {
+						case 1: REQUIRE(support == 21); break;
+						case 2: REQUIRE(support == 6); break;
+						default: REQUIRE(support == 1); break;
+					}
+				}
+			}
+		}
+
+		WHEN("Frequent itemsets are extracted with a minimum support of 6") {
+			const auto frequent_itemsets = frequent_pattern_tree.GetFrequentItemsets(6);
+
+			THEN("Only items and pairs are frequent") {
+				REQUIRE(frequent_itemsets.size() == 8 + 28);
+			}
+		}
+	}
+}
+
+SCENARIO("Parallel Frequent Itemset Generation", "[frequent_pattern_tree]") {
+
+	GIVEN("A frequent pattern tree constructed from itemsets which produce large conditional trees") {
+		const auto itemsets = GetSkewedItemsets();
+
+		const FrequentPatternTree<int> frequent_pattern_tree{itemsets.cbegin(), itemsets.cend()};
+
+		WHEN("Frequent itemsets are extracted in parallel with a minimum support of 20") {
+			ThreadPool thread_pool{4};
+			const auto frequent_itemsets = frequent_pattern_tree.GetFrequentItemsets(20, thread_pool);
+
+			THEN("The frequent itemsets are the same as those which are extracted serially") {
+				const auto expected_frequent_itemsets = frequent_pattern_tree.GetFrequentItemsets(20);
+				REQUIRE(IsEquivalent(frequent_itemsets, expected_frequent_itemsets));
+			}
+		}
+	}
+
+	GIVEN("A frequent pattern tree constructed from every subset of 12 items") {
+		std::vector<std::unordered_set<int>> itemsets;
+
+		for (auto i = 1; i < 1 << 12; ++i) {
+			std::unordered_set<int> itemset;
+			for (auto item = 0; item < 12; ++item) {
+				if (i & 1 << item) itemset.insert(item);
+			}
+			itemsets.push_back(itemset);
+		}
+
+		const FrequentPatternTree<int> frequent_pattern_tree{itemsets.cbegin(), itemsets.cend()};
+
+		WHEN("Frequent itemsets are extracted in parallel from conditional trees deep enough to be split into tasks") {
+			ThreadPool thread_pool{4};
+			const auto frequent_itemsets = frequent_pattern_tree.GetFrequentItemsets(1, thread_pool);
+
+			THEN("The frequent itemsets are the same as those which are extracted serially") {
+				const auto expected_frequent_itemsets = frequent_pattern_tree.GetFrequentItemsets(1);
+				REQUIRE(frequent_itemsets.size() == (1 << 12) - 1);
+				REQUIRE(IsEquivalent(frequent_itemsets, expected_frequent_itemsets));
+			}
+		}
+	}
+}
+
+SCENARIO("Parallel Frequent Pattern Tree Construction", "[frequent_pattern_tree]") {
+
+	GIVEN("Itemsets which span many branches of a frequent pattern tree") {
+		const auto itemsets = GetSkewedItemsets();
+
+		WHEN("A frequent pattern tree is constructed in parallel") {
+			ThreadPool thread_pool{4};
+			const FrequentPatternTree<int> frequent_pattern_tree{itemsets.cbegin(), itemsets.cend(), thread_pool};
+			const FrequentPatternTree<int> expected_frequent_pattern_tree{itemsets.cbegin(), itemsets.cend()};
+
+			THEN("The frequent itemsets are the same as those of a tree which is constructed serially") {
+				const auto frequent_itemsets = frequent_pattern_tree.GetFrequentItemsets(20);
+				const auto expected_frequent_itemsets = expected_frequent_pattern_tree.GetFrequentItemsets(20);
+				REQUIRE(IsEquivalent(frequent_itemsets, expected_frequent_itemsets));
+			}
+		}
+
+		WHEN("A frequent pattern tree is constructed in parallel with a minimum support of 300") {
+			ThreadPool thread_pool{4};
+			const FrequentPatternTree<int> frequent_pattern_tree{itemsets.cbegin(), itemsets.cend(), 300, thread_pool};
+			const FrequentPatternTree<int> expected_frequent_pattern_tree{itemsets.cbegin(), itemsets.cend(), 300};
+
+			THEN("The items counted in parallel are the same as those counted serially") {
+				const auto frequent_itemsets = frequent_pattern_tree.GetFrequentItemsets(300);
+				const auto expected_frequent_itemsets = expected_frequent_pattern_tree.GetFrequentItemsets(300);
+				REQUIRE(IsEquivalent(frequent_itemsets, expected_frequent_itemsets));
+			}
+		}
+
+		WHEN("A frequent pattern tree is constructed in parallel with more threads than itemsets") {
+			ThreadPool thread_pool{4};
+			const FrequentPatternTree<int> frequent_pattern_tree{itemsets.cbegin(), std::next(itemsets.cbegin(), 2), thread_pool};
+			const FrequentPatternTree<int> expected_frequent_pattern_tree{itemsets.cbegin(), std::next(itemsets.cbegin(), 2)};
+
+			THEN("The frequent itemsets are the same as those of a tree which is constructed serially") {
+				const auto frequent_itemsets = frequent_pattern_tree.GetFrequentItemsets(1);
+				const auto expected_frequent_itemsets = expected_frequent_pattern_tree.GetFrequentItemsets(1);
+				REQUIRE(IsEquivalent(frequent_itemsets, expected_frequent_itemsets));
+			}
+		}
+	}
+}
+
+SCENARIO("Concurrent Frequent Itemset Generation", "[frequent_pattern_tree]") {
+
+	GIVEN("Frequent pattern trees which are shared between threads") {
+		const auto itemsets = GetSkewedItemsets();
+
+		const FrequentPatternTree<int> frequent_pattern_tree{itemsets.cbegin(), itemsets.cend()};
+		const FrequentPatternTree<int> other_frequent_pattern_tree{itemsets.cbegin(), std::next(itemsets.cbegin(), 1000)};
+
+		WHEN("Several threads extract frequent itemsets from the same trees at once") {
+			std::vector<std::vector<FrequentPatternTree<int>::FrequentItemset>> thread_frequent_itemsets(4);
+			std::vector<std::thread> threads;
+
+			for (std::size_t i = 0; i < thread_frequent_itemsets.size(); ++i) {
+				threads.emplace_back([&, i] {
+					const auto& tree = i % 2 ? other_frequent_pattern_tree : frequent_pattern_tree;
+					thread_frequent_itemsets[i] = tree.GetFrequentItemsets(20);
+				});
+			}
+
+			for (auto& thread : threads) {
+				thread.join();
+			}
+
+			THEN("Each thread extracts the same frequent itemsets as a query run on its own") {
+				const auto expected_frequent_itemsets = frequent_pattern_tree.GetFrequentItemsets(20);
+				const auto other_expected_frequent_itemsets = other_frequent_pattern_tree.GetFrequentItemsets(20);
+
+				for (std::size_t i = 0; i < thread_frequent_itemsets.size(); ++i) {
+					const auto& frequent_itemsets = thread_frequent_itemsets[i];
+					const auto& expected = i % 2 ? other_expected_frequent_itemsets : expected_frequent_itemsets;
+					REQUIRE(IsEquivalent(frequent_itemsets, expected));
+				}
+			}
+		}
+	}
+}
+
+SCENARIO("Frequent Itemset Generation Over Large Trees", "[frequent_pattern_tree]") {
+
+	GIVEN("A frequent pattern tree constructed from enough itemsets to span multiple node arena chunks") {
+		std::vector<std::unordered_set<int>> itemsets;
+
+		for (auto i = 0; i < 300; ++i) {
+			itemsets.push_back({i, 1000 + i});
+		}
+
+		const FrequentPatternTree<int> frequent_pattern_tree{itemsets.cbegin(), itemsets.cend()};
+
+		WHEN("Frequent itemsets are extracted with a minimum support of 1") {
+			const auto frequent_itemsets = frequent_pattern_tree.GetFrequentItemsets(1);
+
+			THEN("The number of frequent itemsets is equal to the number of unique combinations in each itemset") {
+				REQUIRE(frequent_itemsets.size() == 900);
+			}
+
+			THEN("The frequent itemsets contains the itemset {299, 1299}") {
+				const auto itemset = std::unordered_set<int>{299, 1299};
+				const auto iterator = std::find_if(frequent_itemsets.begin(), frequent_itemsets.end(),
+					[&](const auto& frequent_itemset) { return frequent_itemset.items == itemset; });
+				REQUIRE(iterator != frequent_itemsets.end());
+			}
+		}
+
+		WHEN("Frequent itemsets are extracted with a minimum support of 2") {
+			const auto frequent_itemsets = frequent_pattern_tree.GetFrequentItemsets(2);
+
+			THEN("No frequent itemsets exist") {
+				REQUIRE(frequent_itemsets.empty());
+			}
+		}
+	}
+}
+
+SCENARIO("Frequent Itemset Generation Over Wide Nodes", "[frequent_pattern_tree]") {
+
+	GIVEN("A frequent pattern tree whose nodes each have many children") {
+		std::vector<std::unordered_set<int>> itemsets;
+
+		for (auto i = 0; i < 100; ++i) {
+			itemsets.push_back({i, 100 + i % 10});
+		}
+
+		FrequentPatternTree<int> frequent_pattern_tree{itemsets.cbegin(), itemsets.cend()};
+
+		WHEN("Frequent itemsets are extracted with a minimum support of 1") {
+			const auto frequent_itemsets = frequent_pattern_tree.GetFrequentItemsets(1);
+
+			THEN("Every item and every pair is found exactly once") {
+				REQUIRE(frequent_itemsets.size() == 100 + 10 + 100);
+			}
+		}
+
+		WHEN("Most itemsets are removed so that each node has few children") {
+			frequent_pattern_tree.Remove(itemsets.cbegin(), std::next(itemsets.cbegin(), 95));
+
+			THEN("Only the remaining itemsets are found") {
+				REQUIRE(frequent_pattern_tree.GetFrequentItemsets(1).size() == 5 + 5 + 5);
+			}
+
+			AND_WHEN("The removed itemsets are inserted again") {
+				frequent_pattern_tree.Insert(itemsets.cbegin(), std::next(itemsets.cbegin(), 95));
+
+				THEN("Every item and every pair is found exactly once") {
+					const auto frequent_itemsets = frequent_pattern_tree.GetFrequentItemsets(1);
+					REQUIRE(frequent_itemsets.size() == 100 + 10 + 100);
+					REQUIRE(std::all_of(frequent_itemsets.cbegin(), frequent_itemsets.cend(), [](const auto& frequent_itemset) {
+						const auto& items = frequent_itemset.items;
+						return frequent_itemset.support == (items.size() == 1 && *items.cbegin() >= 100 ? 10u : 1u);
+					}));
+				}
+			}
+		}
+	}
+}
+
+SCENARIO("Frequent Pattern Tree Moves", "[frequent_pattern_tree]") {
+
+	GIVEN("A frequent pattern tree which is moved into another tree") {
+		const std::vector<std::unordered_set<char>> itemsets{{'A', 'B'}, {'A'}};
+		FrequentPatternTree<char> frequent_pattern_tree{itemsets.cbegin(), itemsets.cend()};
+		FrequentPatternTree<char> moved_frequent_pattern_tree{std::move(frequent_pattern_tree)};
+
+		WHEN("Itemsets are inserted into the moved-from tree") {
+			frequent_pattern_tree.Insert(itemsets.cbegin(), itemsets.cend());
+
+			THEN("The moved-from tree is a separate tree") {
+				REQUIRE(frequent_pattern_tree.GetTransactionCount() == 2);
+				REQUIRE(frequent_pattern_tree.GetFrequentItemsets(1).size() == 3);
+			}
+
+			THEN("The tree which was moved into is unchanged") {
+				const auto frequent_itemsets = moved_frequent_pattern_tree.GetFrequentItemsets(1);
+				REQUIRE(moved_frequent_pattern_tree.GetTransactionCount() == 2);
+				REQUIRE(frequent_itemsets.size() == 3);
+				REQUIRE(std::all_of(frequent_itemsets.cbegin(), frequent_itemsets.cend(), [](const auto& frequent_itemset) {
+					return frequent_itemset.support == (frequent_itemset.items == std::unordered_set<char>{'A'} ? 2u : 1u);
+				}));
+			}
+		}
+
+		WHEN("The tree which was moved into is moved back") {
+			frequent_pattern_tree = std::move(moved_frequent_pattern_tree);
+
+			THEN("The tree which was moved back is unchanged") {
+				REQUIRE(frequent_pattern_tree.GetFrequentItemsets(1).size() == 3);
+			}
+
+			THEN("The tree which was moved from is empty") {
+				REQUIRE(moved_frequent_pattern_tree.GetTransactionCount() == 0);
+				REQUIRE(moved_frequent_pattern_tree.GetFrequentItemsets(1).empty());
+			}
+		}
+	}
+}
+
+SCENARIO("Frequent Itemset Generation Over Non-Trivial Item Types", "[frequent_pattern_tree]") {
+
+	GIVEN("A frequent pattern tree constructed from itemsets of strings") {
+		const FrequentPatternTree<std::string> frequent_pattern_tree{
+			{"bread", "milk"},
+			{"bread", "diapers", "beer", "eggs"},
+			{"milk", "diapers", "beer", "cola"},
+			{"bread", "milk", "diapers", "beer"},
+			{"bread", "milk", "diapers", "cola"}
+		};
+
+		WHEN("Frequent itemsets are extracted with a minimum support of 3") {
+			const auto frequent_itemsets = frequent_pattern_tree.GetFrequentItemsets(3);
+
+			THEN("The size of the frequent itemsets is equal to 8") {
+				REQUIRE(frequent_itemsets.size() == 8);
+			}
+
+			THEN("The frequent itemsets contains the itemset {\"diapers\", \"beer\"}") {
+				const auto itemset = std::unordered_set<std::string>{"diapers", "beer"};
+				const auto iterator = std::find_if(frequent_itemsets.begin(), frequent_itemsets.end(),
+					[&](const auto& frequent_itemset) { return frequent_itemset.items == itemset; });
+				REQUIRE(iterator != frequent_itemsets.end());
+			}
+
+			THEN("The frequent itemsets does not contain the itemset {\"bread\", \"beer\"}") {
+				const auto itemset = std::unordered_set<std::string>{"bread", "beer"};
+				const auto iterator = std::find_if(frequent_itemsets.begin(), frequent_itemsets.end(),
+					[&](const auto& frequent_itemset) { return frequent_itemset.items == itemset; });
+				REQUIRE(iterator == frequent_itemsets.end());
+			}
 		}
 	}
 }
@@ -0,0 +1,115 @@
+#include "catch.hpp"
+#include "frequent_pattern_window.hpp"
+#include "test_utilities.hpp"
+
+#include <chrono>
+#include <cstddef>
+#include <limits>
+#include <random>
+#include <unordered_set>
+#include <vector>
+
+using namespace fpt;
+using namespace fpt::test;
+
+SCENARIO("Sliding Window Frequent Itemset Generation", "[frequent_pattern_window]") {
+
+	GIVEN("A stream of itemsets with overlapping elements") {
+		const std::vector<std::unordered_set<char>> itemsets{
+			{'B', 'C', 'D'},
+			{'B', 'C', 'D', 'E'},
+			{'D', 'E'},
+			{'A', 'B', 'C', 'D'},
+			{'A', 'B', 'D'},
+			{'A', 'F'},
+			{'A', 'E', 'F'},
+			{'A', 'F'}
+		};
+
+		const std::chrono::steady_clock::time_point start;
+
+		WHEN("Every itemset is inserted into a window bounded by an itemset count") {
+			FrequentPatternWindow<char> frequent_pattern_window{3};
+
+			for (const auto& itemset : itemsets) {
+				frequent_pattern_window.Insert(itemset, start);
+			}
+
+			const FrequentPatternTree<char> expected_frequent_pattern_tree{std::prev(itemsets.cend(), 3), itemsets.cend()};
+
+			THEN("Only the most recent itemsets remain in the window") {
+				REQUIRE(frequent_pattern_window.size() == 3);
+				REQUIRE(frequent_pattern_window.GetFrequentPatternTree().GetTransactionCount() == 3);
+			}
+
+			THEN("The frequent itemsets are those of the most recent itemsets") {
+				REQUIRE(IsEquivalent(
+					frequent_pattern_window.GetFrequentItemsets(1), expected_frequent_pattern_tree.GetFrequentItemsets(1)));
+			}
+		}
+
+		WHEN("Every itemset is inserted a minute apart into a window bounded by an age of five minutes") {
+			FrequentPatternWindow<char> frequent_pattern_window{std::numeric_limits<std::size_t>::max(), std::chrono::minutes{5}};
+
+			for (std::size_t i = 0; i < itemsets.size(); ++i) {
+				frequent_pattern_window.Insert(itemsets[i], start + std::chrono::minutes{i});
+			}
+
+			const FrequentPatternTree<char> expected_frequent_pattern_tree{std::prev(itemsets.cend(), 6), itemsets.cend()};
+
+			THEN("The frequent itemsets are those of the itemsets inserted within the last five minutes") {
+				REQUIRE(frequent_pattern_window.size() == 6);
+				REQUIRE(IsEquivalent(
+					frequent_pattern_window.GetFrequentItemsets(2), expected_frequent_pattern_tree.GetFrequentItemsets(2)));
+			}
+
+			AND_WHEN("The window is expired with no further itemsets") {
+				frequent_pattern_window.Expire(start + std::chrono::minutes{20});
+
+				THEN("The window is empty") {
+					REQUIRE(frequent_pattern_window.size() == 0);
+					REQUIRE(frequent_pattern_window.GetFrequentItemsets(1).empty());
+					REQUIRE(frequent_pattern_window.GetFrequentItemsets(0).empty());
+				}
+			}
+		}
+	}
+}
+
+SCENARIO("Sliding Window Expiration Cost", "[frequent_pattern_window]") {
+
+	GIVEN("Windows of very different sizes over a stream of itemsets drawn from 200 items") {
+		std::mt19937 random_number_generator;
+		std::vector<std::unordered_set<int>> itemsets;
+
+		for (auto i = 0; i < 34000; ++i) {
+			std::unordered_set<int> itemset;
+			while (itemset.size() < 6) itemset.insert(static_cast<int>(random_number_generator() % 200));
+			itemsets.push_back(itemset);
+		}
+
+		const auto get_insertion_time = [&](const std::size_t window_size) {
+			FrequentPatternWindow<int> frequent_pattern_window{window_size};
+
+			for (std::size_t i = 0; i < window_size; ++i) {
+				frequent_pattern_window.Insert(itemsets[i]);
+			}
+
+			// every insertion into a full window also expires the oldest itemset
+			const auto start = std::chrono::steady_clock::now();
+			for (auto i = window_size; i < window_size + 2000; ++i) {
+				frequent_pattern_window.Insert(itemsets[i]);
+			}
+			return std::chrono::steady_clock::now() - start;
+		};
+
+		WHEN("Itemsets are inserted into full windows of 1000 and 32000 itemsets") {
+			const auto small_window_time = get_insertion_time(1000);
+			const auto large_window_time = get_insertion_time(32000);
+
+			THEN("The cost of expiring an itemset does not grow with the size of the window") {
+				REQUIRE(large_window_time < 3 * small_window_time);
+			}
+		}
+	}
+}
@@ -0,0 +1,32 @@
+#pragma once
+
+#include <algorithm>
+#include <unordered_set>
+#include <vector>
+
+namespace fpt::test {
+
+	/** \brief Determines if two collections of frequent itemsets hold the same itemsets and supports in any order. */
+	template <typename FrequentItemsets>
+	bool IsEquivalent(const FrequentItemsets& frequent_itemsets, const FrequentItemsets& expected_frequent_itemsets) {
+		return frequent_itemsets.size() == expected_frequent_itemsets.size()
+			&& std::is_permutation(frequent_itemsets.cbegin(), frequent_itemsets.cend(), expected_frequent_itemsets.cbegin(),
+				[](const auto& a, const auto& b) { return a.items == b.items && a.support == b.support; });
+	}
+
+	/** \brief Gets 2000 deterministic itemsets over 16 items in which lower items occur more often. */
+	inline std::vector<std::unordered_set<int>> GetSkewedItemsets() {
+
+		std::vector<std::unordered_set<int>> itemsets;
+
+		for (auto i = 0; i < 2000; ++i) {
+			std::unordered_set<int> itemset;
+			for (auto item = 0; item < 16; ++item) {
+				if ((i * 7919 + item * 104729) % (item + 3) < 2) itemset.insert(item);
+			}
+			itemsets.push_back(itemset);
+		}
+
+		return itemsets;
+	}
+}
@@ -0,0 +1,72 @@
+#include "catch.hpp"
+#include "thread_pool.hpp"
+
+#include <atomic>
+#include <vector>
+
+using namespace fpt;
+
+SCENARIO("Work Stealing Task Execution", "[thread_pool]") {
+
+	GIVEN("A thread pool with multiple threads") {
+		ThreadPool thread_pool{4};
+
+		WHEN("Tasks are submitted and waited on") {
+			std::atomic<int> task_count{0};
+
+			for (auto i = 0; i < 100; ++i) {
+				thread_pool.Submit([&] { ++task_count; });
+			}
+			thread_pool.Wait();
+
+			THEN("Every task has run") {
+				REQUIRE(task_count == 100);
+			}
+		}
+
+		WHEN("Tasks submit further tasks") {
+			std::atomic<int> task_count{0};
+
+			for (auto i = 0; i < 10; ++i) {
+				thread_pool.Submit([&] {
+					++task_count;
+					for (auto j = 0; j < 10; ++j) {
+						thread_pool.Submit([&] { ++task_count; });
+					}
+				});
+			}
+			thread_pool.Wait();
+
+			THEN("Every task and every task it submitted has run") {
+				REQUIRE(task_count == 110);
+			}
+		}
+
+		WHEN("Each task records the index of the thread which ran it") {
+			std::vector<std::atomic<int>> thread_task_counts(thread_pool.GetThreadCount() + 1);
+
+			for (auto i = 0; i < 100; ++i) {
+				thread_pool.Submit([&] { ++thread_task_counts[thread_pool.GetThreadIndex()]; });
+			}
+			thread_pool.Wait();
+
+			THEN("Every thread index is within the range of the thread pool") {
+				auto task_count = 0;
+				for (const auto& thread_task_count : thread_task_counts) task_count += thread_task_count;
+				REQUIRE(task_count == 100);
+			}
+		}
+	}
+
+	GIVEN("A thread pool with a single thread") {
+		ThreadPool thread_pool{1};
+
+		WHEN("A thread outside the pool queries its thread index") {
+			const auto thread_index = thread_pool.GetThreadIndex();
+
+			THEN("The thread index is equal to the thread count") {
+				REQUIRE(thread_index == thread_pool.GetThreadCount());
+			}
+		}
+	}
+}